@@ -0,0 +1,293 @@
+#include <SFML/Graphics.hpp>
+#include <SFML/System.hpp>
+#include <entt/entt.hpp>
+
+#include "AppContext.hpp"
+#include "ECS/CommandBuffer.hpp"
+#include "ECS/Components.hpp"
+#include "ECS/Systems.hpp"
+#include "Utilities/RandomMachine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <memory_resource>
+#include <print>
+#include <string_view>
+#include <vector>
+
+// Frame time of the ball/brick hot loops (movement + collision) with N balls and
+// M bricks: the owning groups the game uses (CoreSystems) against the multi-component
+// views + per-entity registry.get lookups they replaced.
+//
+// Run it from the build directory (AppContext loads config/WindowConfig.toml):
+//     breakdown_bench [balls] [bricks] [frames]
+
+namespace
+{
+    constexpr std::uint64_t SceneSeed = 1234;
+    constexpr int WarmupFrames = 60;
+    constexpr float StepRate = 120.0f;
+    constexpr float BallSpeed = 400.0f;
+    constexpr float BallRadius = 6.0f;
+    constexpr float PaddleHeight = 10.0f;
+    constexpr int BrickColumns = 32;
+
+    //$ ----- View baseline ----- //
+    // Same ball/brick logic as CoreSystems, iterated the way it was before the groups.
+    // Sounds, scoring and level end are left out: bricks can't break in this scene and
+    // sounds are muted, so the game systems skip those too.
+    namespace ViewSystems
+    {
+        void movementSystem(entt::registry& registry, sf::Time deltaTime)
+        {
+            auto ballView = registry.view<Ball, Velocity>();
+            for (auto ballEntity : ballView)
+            {
+                auto& ballShape = ballView.get<Ball>(ballEntity);
+                const auto& velocity = ballView.get<Velocity>(ballEntity);
+
+                ballShape.shape.move(velocity.value * deltaTime.asSeconds());
+            }
+        }
+
+        void collisionSystem(AppContext& context, entt::registry& registry)
+        {
+            sf::Vector2f windowSize = { context.m_AppSettings.targetWidth,
+                                        context.m_AppSettings.targetHeight };
+
+            struct CachedBrick { entt::entity entity; sf::FloatRect bounds; };
+            std::pmr::memory_resource* frameMemory = context.m_FrameArena->resource();
+
+            auto brickView = registry.view<Brick>();
+            auto paddleView = registry.view<Paddle, Velocity>();
+
+            std::pmr::vector<CachedBrick> brickCache(frameMemory);
+            std::pmr::vector<sf::FloatRect> paddleBoundsList(frameMemory);
+            brickCache.reserve(brickView.size());
+            paddleBoundsList.reserve(paddleView.size_hint());
+
+            for (auto paddleEntity : paddleView)
+            {
+                paddleBoundsList.push_back(paddleView.get<Paddle>(paddleEntity).shape.getGlobalBounds());
+            }
+
+            for (auto brickEntity : brickView)
+            {
+                auto& brickComp = registry.get<Brick>(brickEntity);
+                brickCache.push_back({ brickEntity, brickComp.shape.getGlobalBounds() });
+            }
+
+            auto ballView = registry.view<Ball, Velocity, MovementSpeed>();
+            for (auto ballEntity : ballView)
+            {
+                auto& ballComp = registry.get<Ball>(ballEntity);
+                auto& ballVelocity = registry.get<Velocity>(ballEntity);
+                float ballSpeed = registry.get<MovementSpeed>(ballEntity).value;
+
+                sf::Vector2f ballPosition = ballComp.shape.getPosition();
+                float ballRadius = ballComp.shape.getRadius();
+
+                if (ballPosition.x - ballRadius < 0.0f)
+                {
+                    ballPosition.x = ballRadius;
+                    ballVelocity.value.x *= -1.0f;
+                }
+                if (ballPosition.x + ballRadius > windowSize.x)
+                {
+                    ballPosition.x = windowSize.x - ballRadius;
+                    ballVelocity.value.x *= -1.0f;
+                }
+                if (ballPosition.y - ballRadius < 0.0f)
+                {
+                    ballPosition.y = ballRadius;
+                    ballVelocity.value.y *= -1.0f;
+                }
+
+                ballComp.shape.setPosition(ballPosition);
+                sf::FloatRect ballBounds = ballComp.shape.getGlobalBounds();
+
+                for (const auto& paddleBounds : paddleBoundsList)
+                {
+                    if (ballBounds.findIntersection(paddleBounds))
+                    {
+                        float paddleCenterX = paddleBounds.position.x + paddleBounds.size.x / 2.0f;
+                        float relativeIntersectX = (ballPosition.x - paddleCenterX) /
+                                                   (paddleBounds.size.x / 2.0f);
+                        sf::Angle rotation = sf::degrees(relativeIntersectX * 60.0f);
+                        ballVelocity.value = sf::Vector2f{ 0.0f, -1.0f }.rotatedBy(rotation) * ballSpeed;
+                    }
+                }
+
+                for (const auto& cachedBrick : brickCache)
+                {
+                    if (!registry.valid(cachedBrick.entity))
+                    {
+                        continue;
+                    }
+
+                    if (auto intersection = ballBounds.findIntersection(cachedBrick.bounds))
+                    {
+                        auto& brickShape = registry.get<Brick>(cachedBrick.entity);
+                        auto brickType = registry.get<BrickType>(cachedBrick.entity);
+
+                        if (intersection->size.x > intersection->size.y)
+                        {
+                            float direction = ballBounds.position.y < cachedBrick.bounds.position.y ? -1.0f : 1.0f;
+                            ballComp.shape.move({ 0.0f, direction * intersection->size.y });
+                            ballVelocity.value.y = -ballVelocity.value.y;
+                        }
+                        else
+                        {
+                            float direction = ballBounds.position.x < cachedBrick.bounds.position.x ? -1.0f : 1.0f;
+                            ballComp.shape.move({ direction * intersection->size.x, 0.0f });
+                            ballVelocity.value.x = -ballVelocity.value.x;
+                        }
+
+                        auto& brickHealth = registry.get<BrickHealth>(cachedBrick.entity).current;
+                        brickHealth -= 1;
+                        if (brickHealth > 0 && brickType == BrickType::Strong)
+                        {
+                            brickShape.shape.setFillColor(context.m_Config.bricks.strongDamagedColor);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    //$ ----- Scene ----- //
+    // Bricks fill the top of the window with health that can't run out, balls start
+    // below them and a window-wide paddle keeps them in play, so every frame does the
+    // same amount of work. The same seed gives both variants the same scene.
+    void spawnScene(AppContext& context, entt::registry& registry, int ballCount, int brickCount)
+    {
+        utils::RandomMachine random(SceneSeed);
+        float width = context.m_AppSettings.targetWidth;
+        float height = context.m_AppSettings.targetHeight;
+
+        auto paddleEntity = registry.create();
+        registry.emplace<PaddleTag>(paddleEntity);
+        registry.emplace<Paddle>(paddleEntity, sf::Vector2f{ width, PaddleHeight }, sf::Color::White,
+                                 sf::Vector2f{ width / 2.0f, height - PaddleHeight });
+        registry.emplace<Velocity>(paddleEntity);
+
+        int rows = (brickCount + BrickColumns - 1) / BrickColumns;
+        sf::Vector2f cell = { width / BrickColumns, (height * 0.6f) / std::max(rows, 1) };
+        sf::Vector2f brickSize = { cell.x - 2.0f, std::max(cell.y - 2.0f, 1.0f) };
+        for (int i = 0; i < brickCount; ++i)
+        {
+            sf::Vector2f position = { (i % BrickColumns) * cell.x, (i / BrickColumns) * cell.y };
+            auto type = (i % 3 == 0) ? BrickType::Strong : BrickType::Normal;
+
+            auto brickEntity = registry.create();
+            registry.emplace<BrickTag>(brickEntity);
+            registry.emplace<BrickType>(brickEntity, type);
+            registry.emplace<Brick>(brickEntity, brickSize, sf::Color::Red, position);
+            registry.emplace<BrickScore>(brickEntity);
+            registry.emplace<BrickHealth>(brickEntity, std::numeric_limits<int>::max(),
+                                          std::numeric_limits<int>::max());
+        }
+
+        for (int i = 0; i < ballCount; ++i)
+        {
+            sf::Vector2f position = { random.getFloat(BallRadius, width - BallRadius),
+                                      random.getFloat(height * 0.7f, height * 0.9f) };
+            sf::Angle angle = sf::degrees(random.getFloat(-60.0f, 60.0f));
+
+            auto ballEntity = registry.create();
+            registry.emplace<BallTag>(ballEntity);
+            registry.emplace<Ball>(ballEntity, BallRadius, sf::Color::White, position);
+            registry.emplace<Velocity>(ballEntity, sf::Vector2f{ 0.0f, -BallSpeed }.rotatedBy(angle));
+            registry.emplace<MovementSpeed>(ballEntity, BallSpeed);
+        }
+    }
+
+    //$ ----- Runner ----- //
+    template <typename StepFn>
+    void runVariant(std::string_view name, AppContext& context, bool useGroups,
+                    int ballCount, int brickCount, int frames, StepFn&& step)
+    {
+        entt::registry registry;
+        if (useGroups)
+        {
+            CoreSystems::registerGroups(registry);
+        }
+        spawnScene(context, registry, ballCount, brickCount);
+
+        CommandBuffer commands;
+        sf::Time deltaTime = sf::seconds(1.0f / StepRate);
+
+        auto frame = [&]() {
+            context.m_FrameArena->reset();
+            step(registry, commands, deltaTime);
+            commands.apply(registry);
+        };
+
+        for (int i = 0; i < WarmupFrames; ++i)
+        {
+            frame();
+        }
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(frames);
+        for (int i = 0; i < frames; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            frame();
+            auto end = std::chrono::steady_clock::now();
+            frameTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        std::ranges::sort(frameTimes);
+        double total = 0.0;
+        for (double time : frameTimes)
+        {
+            total += time;
+        }
+
+        std::println("{:<6} mean {:9.2f} us   median {:9.2f} us   p99 {:9.2f} us",
+                     name, total / frames, frameTimes[frames / 2],
+                     frameTimes[std::min(frames - 1, frames * 99 / 100)]);
+    }
+
+    int argOr(int argc, char* argv[], int index, int fallback)
+    {
+        if (index >= argc)
+        {
+            return fallback;
+        }
+        int value = std::atoi(argv[index]);
+        return value > 0 ? value : fallback;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int ballCount = argOr(argc, argv, 1, 64);
+    int brickCount = argOr(argc, argv, 2, 2048);
+    int frames = argOr(argc, argv, 3, 2000);
+
+    AppContext context;
+    context.m_AppData.levelStarted = true;
+    context.m_AppSettings.sfxMuted = true;
+
+    std::println("{} balls x {} bricks, {} frames (movement + collision per frame)",
+                 ballCount, brickCount, frames);
+
+    runVariant("view", context, false, ballCount, brickCount, frames,
+        [&context](entt::registry& registry, CommandBuffer&, sf::Time deltaTime) {
+            ViewSystems::movementSystem(registry, deltaTime);
+            ViewSystems::collisionSystem(context, registry);
+        });
+
+    runVariant("group", context, true, ballCount, brickCount, frames,
+        [&context](entt::registry& registry, CommandBuffer& commands, sf::Time deltaTime) {
+            CoreSystems::movementSystem(context, registry, deltaTime);
+            CoreSystems::collisionSystem(context, registry, commands, deltaTime);
+        });
+
+    return 0;
+}
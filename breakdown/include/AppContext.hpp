@@ -8,9 +8,19 @@
 #include "Managers/WindowManager.hpp"
 #include "Managers/GlobalEventManager.hpp"
 #include "Managers/ResourceManager.hpp"
+#include "Managers/LevelPack.hpp"
+#include "Managers/InputBuffer.hpp"
 #include "AssetKeys.hpp"
 #include "AppData.hpp"
+#include "GameConfig.hpp"
+#include "Rendering/Renderer.hpp"
+#include "Rendering/FramePacer.hpp"
+#include "Rendering/LatencyProbe.hpp"
+#include "Utilities/JobSystem.hpp"
+#include "Utilities/MemoryArena.hpp"
+#include "ECS/LevelSnapshot.hpp"
 
+#include <map>
 #include <memory>
 
 class StateManager;
@@ -20,20 +30,24 @@ struct AppContext
     AppContext() {
         // make ConfigManager and load config files first
         m_ConfigManager = std::make_unique<ConfigManager>();
+        m_ConfigManager->openCache("config/Configs.cache");
         m_ConfigManager->loadConfig(Assets::Configs::Window, "config/WindowConfig.toml");
+        m_Config.bindWindow(*m_ConfigManager);
 
         // then initialize the stuff that uses those configs
-        m_WindowManager = std::make_unique<WindowManager>(*m_ConfigManager);
+        m_WindowManager = std::make_unique<WindowManager>(m_Config.window);
         m_ResourceManager = std::make_unique<ResourceManager>();
+        m_LevelPack = std::make_unique<LevelPack>();
+        m_Input = std::make_unique<InputBuffer>();
         m_GlobalEventManager = std::make_unique<GlobalEventManager>(this);
         m_MainClock = std::make_unique<sf::Clock>();
         m_Registry = std::make_unique<entt::registry>();
+        m_FrameArena = std::make_unique<utils::MemoryArena>(utils::ArenaSizes::Frame);
+        m_JobSystem = std::make_unique<utils::JobSystem>();
 
         // Set target width / height
-        m_AppSettings.targetWidth = m_ConfigManager->getConfigValue<float>(
-                      Assets::Configs::Window, "mainWindow", "X").value_or(1280.0f);
-        m_AppSettings.targetHeight = m_ConfigManager->getConfigValue<float>(
-                      Assets::Configs::Window, "mainWindow", "Y").value_or(720.0f);
+        m_AppSettings.targetWidth = static_cast<float>(m_Config.window.width);
+        m_AppSettings.targetHeight = static_cast<float>(m_Config.window.height);
     }
 
     AppContext(const AppContext&) = delete;
@@ -46,13 +60,36 @@ struct AppContext
     std::unique_ptr<WindowManager> m_WindowManager{ nullptr };
     std::unique_ptr<GlobalEventManager> m_GlobalEventManager{ nullptr };
     std::unique_ptr<ResourceManager> m_ResourceManager{ nullptr };
+    // Compiled levels, decoded on demand (see Application::initResources)
+    std::unique_ptr<LevelPack> m_LevelPack{ nullptr };
+    // Timestamped key events for the fixed simulation steps (see PlayState::update)
+    std::unique_ptr<InputBuffer> m_Input{ nullptr };
     std::unique_ptr<sf::Clock> m_MainClock{ nullptr };
+    // Shared registry for cross-state data only; each State owns its own registry
     std::unique_ptr<entt::registry> m_Registry{ nullptr };
+    // Scratch memory for systems; reset at the start of every frame in Application::run
+    std::unique_ptr<utils::MemoryArena> m_FrameArena{ nullptr };
+    // Worker threads for anything that can run off the main thread (declared after the
+    // managers so it shuts down, finishing queued jobs, before they are destroyed)
+    std::unique_ptr<utils::JobSystem> m_JobSystem{ nullptr };
+    // Input-to-present measurements; null unless [latencyProbe] is enabled (declared
+    // before the Renderer, whose thread reports into it)
+    std::unique_ptr<LatencyProbe> m_LatencyProbe{ nullptr };
+    // Draws the published frames (created with the main window, see Application)
+    std::unique_ptr<Renderer> m_Renderer{ nullptr };
+    // Frame limiting and frame time stats (created with the main window)
+    std::unique_ptr<FramePacer> m_FramePacer{ nullptr };
     
+    // Config files bound into structs; read these instead of looking keys up
+    GameConfig m_Config;
+
     // AppData members
     AppSettings m_AppSettings;
     AppData m_AppData;
 
+    // Initial entity state per level number, built on first play (see EntityFactory)
+    std::map<int, LevelSnapshot> m_LevelSnapshots;
+
     // Pointers to Application-level objects
     sf::RenderWindow* m_MainWindow{ nullptr };
     StateManager* m_StateManager{ nullptr };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SFML/Audio.hpp>
+#include <entt/entt.hpp>
 
 #include "Utilities/Logger.hpp"
 
@@ -36,17 +37,22 @@ struct AppSettings
     bool sfxMuted{ false };
     float musicVolume{ 100.0f };
     float sfxVolume{ 100.0f };
+
+    // Published after any of the audio settings above change
+    entt::sigh<void(const AppSettings&)> changed;
     
     void toggleMusicMute()
     {
         musicMuted = !musicMuted;
         logger::Info(std::format("Music muted: {}", musicMuted ? "true" : "false"));
+        changed.publish(*this);
     }
     
     void toggleSfxMute()
     {
         sfxMuted = !sfxMuted;
         logger::Info(std::format("SFX muted: {}", sfxMuted ? "true" : "false"));
+        changed.publish(*this);
     }
     
     float getMusicVolume()
@@ -76,6 +82,7 @@ struct AppSettings
         music.setVolume(musicVolume);
         
         logger::Info(std::format("Music volume set to: {}", musicVolume));
+        changed.publish(*this);
     }
     
     void setSfxVolume(float volume)
@@ -92,5 +99,6 @@ struct AppSettings
         }
         
         logger::Info(std::format("SFX volume set to: {}", sfxVolume));
+        changed.publish(*this);
     }
 };
\ No newline at end of file
@@ -1,7 +1,9 @@
 #include <SFML/System.hpp>
+#include <SFML/Window/Event.hpp>
 
 #include "AppContext.hpp"
 #include "Managers/StateManager.hpp"
+#include "Managers/HotReloader.hpp"
 
 class Application
 {
@@ -15,13 +17,32 @@ public:
 
 private:
     void initMainWindow();
+    void initFramePacing();
+    [[nodiscard]] RendererSettings loadRendererSettings() const;
     void initResources();
+    // Glyphs for Assets::TextSizes; fonts are frozen after this (see FontPreload)
+    void preloadFonts();
+
+    // Poll and dispatch everything queued; returns false if there was nothing
+    bool processEvents();
+    // Idle: block up to timeout for an event, then dispatch it (+ anything queued).
+    // Returns false if nothing arrived.
+    bool waitForEvents(sf::Time timeout);
+    // Global bus first, then the current state's bus if nothing consumed it
+    void dispatchEvent(const sf::Event& event);
+    void registerEventHandlers();
+    void onResized(const sf::Event::Resized& event);
 
-    void processEvents();
     void update(sf::Time deltaTime);
     void render();
 
     // Resources
     AppContext m_AppContext;
     StateManager m_StateManager;
+    HotReloader m_HotReloader{ m_AppContext };
+
+    // Idle loop
+    bool m_HasFocus{ true };
+    sf::Time m_IdleTimeout{ sf::milliseconds(250) };
+    sf::Time m_UnfocusedTimeout{ sf::milliseconds(1000) };
 };
\ No newline at end of file
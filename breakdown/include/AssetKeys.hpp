@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string_view>
 
 namespace Assets
@@ -9,6 +10,15 @@ namespace Assets
         constexpr std::string_view MainFont = "MainFont";
         constexpr std::string_view ScoreFont = "ScoreFont";
     }
+    // Every character size text is drawn at, per font. Their glyphs are loaded at startup
+    // and the fonts are frozen after that (see FontPreload): add new sizes here.
+    namespace TextSizes
+    {
+        // debug stats, buttons, "Loading...", pause / transition titles
+        constexpr std::array<unsigned int, 4> MainFont = { 16, 50, 64, 100 };
+        // score, settings labels, volume values, Back button, menu title
+        constexpr std::array<unsigned int, 5> ScoreFont = { 32, 36, 48, 50, 120 };
+    }
     namespace Textures
     {
         constexpr std::string_view ButtonRedX = "ButtonRedX";
@@ -36,5 +46,6 @@ namespace Assets
         constexpr std::string_view Ball = "Ball";
         constexpr std::string_view Bricks = "Bricks";
         constexpr std::string_view Levels = "Levels";
+        constexpr std::string_view Manifest = "AssetsManifest";
     }
 }
\ No newline at end of file
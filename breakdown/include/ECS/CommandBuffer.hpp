@@ -0,0 +1,32 @@
+#pragma once
+
+#include <entt/entt.hpp>
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Structural changes recorded by systems while they run (possibly on worker threads)
+// and played back on the main thread at the scheduler's sync point.
+// Recording is thread safe; apply() is not and must not overlap with running systems.
+class CommandBuffer
+{
+public:
+    CommandBuffer() = default;
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    void destroy(entt::entity entity);
+    // Anything else that can't happen mid-frame (create/emplace/remove, state transitions...)
+    void defer(std::function<void(entt::registry&)> command);
+
+    // Destroys first, then runs the deferred commands in the order they were recorded
+    void apply(entt::registry& registry);
+
+    [[nodiscard]] bool empty() const;
+
+private:
+    mutable std::mutex m_Mutex;
+    std::vector<entt::entity> m_Destroyed;
+    std::vector<std::function<void(entt::registry&)>> m_Commands;
+};
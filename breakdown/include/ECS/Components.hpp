@@ -3,9 +3,10 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 
+#include "Utilities/InplaceFunction.hpp"
 #include "Utilities/Utils.hpp"
 
-#include <functional>
+#include <cstddef>
 
 //$ ----- Game Components ----- //
 
@@ -58,6 +59,7 @@ struct ConfineToWindow
 
 //$ ----- Brick Components ----- //
 enum class BrickType { Normal, Strong, Gold, Custom_1, Custom_2 };
+constexpr std::size_t BrickTypeCount = 5;
 
 struct Brick
 {
@@ -93,15 +95,18 @@ struct GUIButtonTag {};
 
 struct UIHover {};
 
+// Visual state needs recomputing (set on change notifications, cleared by the system)
+struct UIDirty {};
+
 struct UIText { sf::Text text; };
 
 struct UIShape { sf::RectangleShape shape; };
 
 struct UIBounds { sf::FloatRect rect; };
 
-struct UIAction { std::function<void()> action; };
+struct UIAction { utils::InplaceFunction<void()> action; };
 
-struct UIToggleCond { std::function<bool()> shouldShowOverlay; };
+struct UIToggleCond { utils::InplaceFunction<bool()> shouldShowOverlay; };
 
 struct GUISprite { sf::Sprite sprite; };
 
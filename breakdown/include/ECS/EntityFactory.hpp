@@ -6,58 +6,77 @@
 
 #include "AppContext.hpp"
 #include "Components.hpp"
+#include "LevelSnapshot.hpp"
 
-#include <functional>
+#include <memory_resource>
+#include <optional>
 
 namespace EntityFactory
 {
     //$ --- Game Play Entities --- //
-    entt::entity createPlayer(AppContext& context);
+    entt::entity createPlayer(AppContext& context, entt::registry& registry);
 
-    entt::entity createBall(AppContext& context);
+    entt::entity createBall(AppContext& context, entt::registry& registry);
+
+    BrickArchetype loadBrickArchetype(AppContext& context, BrickType type);
 
     entt::entity createABrick(AppContext& context,
+                                entt::registry& registry,
                                 sf::Vector2f size,
                                 sf::Vector2f position,
                                 BrickType type = BrickType::Normal);
 
-    void createBricks(AppContext& context);
+    void createBricks(AppContext& context, entt::registry& registry);
+
+    // Returns the cached snapshot of a level, building it from the bound configs on first use
+    const LevelSnapshot& getLevelSnapshot(AppContext& context, int levelNumber);
+
+    // Stages bricks, paddle and ball from the bound configs and a level decoded from the
+    // pack (LevelPack::acquire, on the main thread). Touches neither the pack,
+    // m_LevelSnapshots nor fonts, so it can run on a worker (see PlayState::load).
+    LevelSnapshot buildLevelSnapshot(AppContext& context, int levelNumber,
+                                     const std::optional<LevelDef>& level);
+
+    // Main thread: adds the font-dependent HUD and caches the snapshot
+    const LevelSnapshot& storeLevelSnapshot(AppContext& context, LevelSnapshot snapshot);
 
-    float loadLevel(AppContext& context, int levelNumber);
+    // Copies a level snapshot (bricks, paddle, ball, HUD) into the registry
+    void spawnLevel(AppContext& context, entt::registry& registry,
+                    const LevelSnapshot& snapshot);
 
     //$ --- HUD Entities --- //
-    entt::entity createScoreDisplay(AppContext& context,
+    entt::entity createScoreDisplay(entt::registry& registry,
                                     sf::Font& font,
                                     unsigned int size,
                                     const sf::Color& color,
                                     sf::Vector2f position);
 
     //$ --- G/UI Entities --- //
-    entt::entity createButton(AppContext& context,
+    entt::entity createButton(entt::registry& registry,
                             sf::Font& font,
                             const std::string& text,
                             sf::Vector2f position,
-                            std::function<void()> action,
+                            utils::InplaceFunction<void()> action,
                             UITags tag = UITags::Menu,
                             sf::Vector2f size = {250.0f, 100.0f});
 
-    entt::entity createGUIButton(AppContext& context,
+    entt::entity createGUIButton(entt::registry& registry,
                                 sf::Texture& texture,
                                 sf::Vector2f position,
-                                std::function<void()> action,
+                                utils::InplaceFunction<void()> action,
                                 UITags tag = UITags::Menu);
 
-    entt::entity createButtonLabel(AppContext& context,
+    entt::entity createButtonLabel(entt::registry& registry,
                                    const entt::entity buttonEntity,
                                    sf::Font& font, const std::string& text,
                                    unsigned int size = 32,
                                    const sf::Color& color = sf::Color::White,
                                    UITags tag = UITags::Menu);
 
-    entt::entity createLabeledButton(AppContext& context, 
+    entt::entity createLabeledButton(entt::registry& registry,
                                     sf::Texture& texture,
                                     sf::Vector2f position,
-                                    std::function<void()> action,
+                                    utils::InplaceFunction<void()> action,
                                     sf::Font& font,
                                     UITags tag = UITags::Menu,
                                     const std::string& text = "",
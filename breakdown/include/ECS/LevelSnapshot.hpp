@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ECS/Components.hpp"
+
+#include <optional>
+#include <vector>
+
+// The initial entity state of a level: built once from the config files and then
+// copied straight into the registry every time the level is (re)started.
+struct LevelSnapshot
+{
+    int levelNumber{ 0 };
+    float descentSpeed{ 0.0f };
+
+    // Bricks in layout (row-major) order, one entry per brick in each array
+    std::vector<BrickType> brickTypes;
+    std::vector<Brick> bricks;
+    std::vector<BrickScore> brickScores;
+    std::vector<BrickHealth> brickHealths;
+
+    // Player paddle
+    std::optional<Paddle> paddle;
+    MovementSpeed paddleSpeed{};
+    ConfineToWindow paddleConfine{};
+
+    // Ball (resting on the paddle)
+    std::optional<Ball> ball;
+    MovementSpeed ballSpeed{};
+
+    // Score HUD (empty if the font couldn't be found)
+    std::optional<UIText> scoreText;
+};
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include <entt/entt.hpp>
+
+#include "AppContext.hpp"
+#include "ECS/CommandBuffer.hpp"
+#include "Utilities/JobSystem.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//$ ----- Access declarations ----- //
+// Systems list what they touch: component types, plus Resource<T> for shared data
+// outside the registry (AppData, sounds, the frame arena...). Two systems are ordered
+// when one writes something the other reads or writes, otherwise they may run in parallel.
+template <typename T>
+struct Resource {};
+
+template <typename... Types>
+struct Reads {};
+
+template <typename... Types>
+struct Writes {};
+
+// What every scheduled system gets handed
+struct SystemContext
+{
+    AppContext& app;
+    entt::registry& registry;
+    CommandBuffer& commands;
+    sf::Time deltaTime;
+};
+
+// Runs a fixed set of systems over one registry on the JobSystem.
+// The systems form a task graph as they are registered (registration order decides
+// who goes first on a conflict). Every frame it runs in parallel where the declared
+// access allows it, and then the command buffer is applied on the main thread.
+// Inside a system: no structural changes on the registry, record them in commands.
+class SystemScheduler
+{
+public:
+    using SystemFn = std::function<void(SystemContext&)>;
+
+    explicit SystemScheduler(entt::registry& registry);
+    SystemScheduler(const SystemScheduler&) = delete;
+    SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+    template <typename... ReadTypes, typename... WriteTypes>
+    void addSystem(std::string name, Reads<ReadTypes...>, Writes<WriteTypes...>, SystemFn system,
+                   utils::JobAffinity affinity = utils::JobAffinity::Any);
+
+    // Runs every system for this frame and blocks until they're done + commands applied
+    void run(AppContext& context, sf::Time deltaTime);
+
+    [[nodiscard]] std::size_t size() const noexcept { return m_Systems.size(); }
+
+private:
+    struct SystemEntry
+    {
+        std::string name;
+        std::vector<entt::id_type> reads;
+        std::vector<entt::id_type> writes;
+        SystemFn system;
+        utils::JobAffinity affinity{ utils::JobAffinity::Any };
+        // earlier systems this one conflicts with
+        std::vector<std::size_t> dependsOn;
+    };
+
+    template <typename T>
+    struct IsResource : std::false_type {};
+    template <typename T>
+    struct IsResource<Resource<T>> : std::true_type {};
+
+    // Create component storages up front: looking up a missing storage from inside a
+    // running system would modify the registry's pool map from several threads
+    template <typename T>
+    void assureStorage()
+    {
+        if constexpr (!IsResource<T>::value)
+        {
+            m_Registry.storage<T>();
+        }
+    }
+
+    void addEntry(SystemEntry entry);
+    static bool conflicts(const SystemEntry& first, const SystemEntry& second);
+
+private:
+    entt::registry& m_Registry;
+    CommandBuffer m_Commands;
+    std::vector<SystemEntry> m_Systems;
+    // One node per system, reused every frame
+    utils::TaskGraph m_Graph;
+    // What the nodes hand to their system; only set during run()
+    SystemContext* m_RunContext{ nullptr };
+};
+
+template <typename... ReadTypes, typename... WriteTypes>
+void SystemScheduler::addSystem(std::string name, Reads<ReadTypes...>, Writes<WriteTypes...>,
+                                SystemFn system, utils::JobAffinity affinity)
+{
+    (assureStorage<ReadTypes>(), ...);
+    (assureStorage<WriteTypes>(), ...);
+
+    SystemEntry entry;
+    entry.name = std::move(name);
+    entry.reads = { entt::type_hash<ReadTypes>::value()... };
+    entry.writes = { entt::type_hash<WriteTypes>::value()... };
+    entry.system = std::move(system);
+    entry.affinity = affinity;
+    addEntry(std::move(entry));
+}
@@ -8,33 +8,67 @@
 #include <AppContext.hpp>
 #include <Managers/StateManager.hpp>
 #include <ECS/Components.hpp>
+#include <ECS/CommandBuffer.hpp>
+#include <Rendering/RenderSnapshot.hpp>
 
+#include <memory_resource>
 #include <string_view>
+#include <utility>
 
 namespace CoreSystems
 {
+    //$ ----- Groups ----- //
+    // Owning groups keep these components packed in lockstep for the hot loops.
+    // A component can only be owned by one group, so don't add owning groups over these.
+    using BallGroup = decltype(std::declval<entt::registry&>().group<Ball, Velocity, MovementSpeed>());
+    using BrickGroup = decltype(std::declval<entt::registry&>().group<Brick, BrickHealth,
+                                                                      BrickScore, BrickType>());
+
+    BallGroup ballGroup(entt::registry& registry);
+    BrickGroup brickGroup(entt::registry& registry);
+
+    // Create the groups before spawning so entities are placed in the packed range directly
+    void registerGroups(entt::registry& registry);
+
     //$ ----- Game Systems ----- //
-    void handlePlayerInput(AppContext& context);
+    void handlePlayerInput(AppContext& context, entt::registry& registry);
 
-    void movementSystem(AppContext& context, sf::Time deltaTime);
+    void movementSystem(AppContext& context, entt::registry& registry, sf::Time deltaTime);
 
-    void collisionSystem(AppContext& context, sf::Time deltaTime);
+    // Brick destruction, sounds and state transitions are recorded in commands, not applied directly
+    void collisionSystem(AppContext& context, entt::registry& registry,
+                         CommandBuffer& commands, sf::Time deltaTime);
 
-    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug);
+    void renderSystem(entt::registry& registry, RenderSnapshot& snapshot, bool showDebug);
 
     void playSound(AppContext& context, std::string_view soundID);
 
     void moveBricksDown(entt::registry& registry, float amount);
+
+    // Hot reload: push the re-bound Player/Ball/Bricks values onto the live entities
+    // (positions, health and the ball's direction are kept)
+    void applyConfigReload(AppContext& context, entt::registry& registry, std::string_view configID);
 }
 
 namespace UISystems
 {
     //$ ----- UI Systems -----
-    void uiRenderSystem(entt::registry& registry, sf::RenderWindow& window);
+    void uiRenderSystem(entt::registry& registry, RenderSnapshot& snapshot);
 
     void uiClickSystem(entt::registry& registry, const sf::Event::MouseButtonPressed& event);
 
-    void uiHoverSystem(entt::registry& registry, sf::RenderWindow& window);
+    // Event driven: call on mouse move / resize / state enter with the mouse in world
+    // coordinates. Only hover enter/leave changes touch the registry.
+    void uiHoverSystem(entt::registry& registry, sf::Vector2f mousePosition);
+
+    // Visual state of interactive UI. Only touched when the hover state changes, so the
+    // entity factory applies the resting (not hovered) style when a button is created
+    void applyHoverStyle(entt::registry& registry, entt::entity entity, bool hovered);
+
+    // Sets up event driven hover for a state's registry: the UIHoverIndex in registry.ctx()
+    // (kept in sync with UIBounds) and the hover colors, applied when UIHover comes and goes
+    void connectUIHover(entt::registry& registry, std::pmr::memory_resource* resource);
     
-    void uiSettingsChecks(AppContext& context);
+    // Only looks at toggle buttons marked UIDirty (settings changed since last time)
+    void uiSettingsChecks(AppContext& context, entt::registry& registry);
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <entt/entt.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+// Uniform grid over the UIBounds of one registry, kept in registry.ctx() so hover
+// tests only look at the entities in the cell under the mouse.
+// Rebuilt lazily after UIBounds are added/changed/removed (see markDirty).
+// Storage comes from the owning state's arena; rebuilds are rare (UI setup), so the
+// arena doesn't grow in practice.
+class UIHoverIndex
+{
+public:
+    explicit UIHoverIndex(std::pmr::memory_resource* resource);
+
+    void markDirty() noexcept { m_Dirty = true; }
+    [[nodiscard]] bool isDirty() const noexcept { return m_Dirty; }
+
+    void rebuild(const entt::registry& registry);
+
+    // Entities whose cell contains point (still needs a bounds check)
+    [[nodiscard]] std::span<const entt::entity> candidatesAt(sf::Vector2f point) const;
+
+    // What was hovered after the last update, for enter/leave detection
+    std::pmr::vector<entt::entity>& hovered() noexcept { return m_Hovered; }
+
+private:
+    static constexpr float CellSize = 128.0f;
+
+    sf::Vector2f m_Origin{};
+    std::size_t m_Columns{ 0 };
+    std::size_t m_Rows{ 0 };
+    std::pmr::vector<std::pmr::vector<entt::entity>> m_Cells;
+    std::pmr::vector<entt::entity> m_Hovered;
+    bool m_Dirty{ true };
+};
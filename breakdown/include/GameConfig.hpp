@@ -0,0 +1,149 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "Managers/ConfigBinding.hpp"
+#include "ECS/Components.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class ConfigManager;
+
+// The config files bound into plain structs (see ConfigBinding). Defaults here are
+// what's used when a key is missing.
+
+//$ ----- WindowConfig.toml ----- //
+struct WindowConfig
+{
+    // [mainWindow]
+    std::string title{ "Breakdown" };
+    unsigned int width{ 1280 };
+    unsigned int height{ 720 };
+
+    // [renderer]
+    bool threadedRendering{ true };
+    bool internalResolution{ false };
+    unsigned int internalWidth{ 1280 };
+    unsigned int internalHeight{ 720 };
+    std::string upscaleFilter{ "nearest" };
+
+    // [framePacing]
+    std::string pacingMode{ "hybrid" };
+    int targetFps{ 60 };
+    int spinMarginUs{ 2000 };
+
+    // [idle]
+    int idleTimeoutMs{ 250 };
+    int unfocusedTimeoutMs{ 1000 };
+
+    // [hotReload]
+    bool hotReload{ true };
+    bool hotReloadRebuildLevel{ false };
+
+    // [simulation]
+    int tickRate{ 120 };
+    int maxStepsPerFrame{ 8 };
+
+    // [latencyProbe]
+    bool latencyProbe{ false };
+    std::string latencyReportPath{ "latency_report.txt" };
+
+    static constexpr std::array<ConfigField<WindowConfig>, 19> Fields{ {
+        { "mainWindow",  "Title",              &WindowConfig::title },
+        { "mainWindow",  "X",                  &WindowConfig::width },
+        { "mainWindow",  "Y",                  &WindowConfig::height },
+        { "renderer",    "threaded",           &WindowConfig::threadedRendering },
+        { "renderer",    "internalResolution", &WindowConfig::internalResolution },
+        { "renderer",    "internalWidth",      &WindowConfig::internalWidth },
+        { "renderer",    "internalHeight",     &WindowConfig::internalHeight },
+        { "renderer",    "upscaleFilter",      &WindowConfig::upscaleFilter },
+        { "framePacing", "mode",               &WindowConfig::pacingMode },
+        { "framePacing", "targetFps",          &WindowConfig::targetFps },
+        { "framePacing", "spinMarginUs",       &WindowConfig::spinMarginUs },
+        { "idle",        "timeoutMs",          &WindowConfig::idleTimeoutMs },
+        { "idle",        "unfocusedTimeoutMs", &WindowConfig::unfocusedTimeoutMs },
+        { "hotReload",   "enabled",            &WindowConfig::hotReload },
+        { "hotReload",   "rebuildLevel",       &WindowConfig::hotReloadRebuildLevel },
+        { "simulation",  "tickRate",           &WindowConfig::tickRate },
+        { "simulation",  "maxStepsPerFrame",   &WindowConfig::maxStepsPerFrame },
+        { "latencyProbe", "enabled",           &WindowConfig::latencyProbe },
+        { "latencyProbe", "reportPath",        &WindowConfig::latencyReportPath },
+    } };
+};
+
+//$ ----- Player.toml / Ball.toml ----- //
+struct PlayerConfig
+{
+    float movementSpeed{ 350.0f };
+    float paddleWidth{ 140.0f };
+    float paddleHeight{ 20.0f };
+    sf::Color paddleColor{ sf::Color::Magenta };
+
+    static constexpr std::array<ConfigField<PlayerConfig>, 4> Fields{ {
+        { "player", "movementSpeed", &PlayerConfig::movementSpeed },
+        { "player", "paddleWidth",   &PlayerConfig::paddleWidth },
+        { "player", "paddleHeight",  &PlayerConfig::paddleHeight },
+        { "player", "paddleRGB",     &PlayerConfig::paddleColor },
+    } };
+};
+
+struct BallConfig
+{
+    float radius{ 25.0f };
+    float speed{ 450.0f };
+    sf::Color color{ sf::Color::Magenta };
+
+    static constexpr std::array<ConfigField<BallConfig>, 3> Fields{ {
+        { "ball", "ballRadius", &BallConfig::radius },
+        { "ball", "ballSpeed",  &BallConfig::speed },
+        { "ball", "ballRGB",    &BallConfig::color },
+    } };
+};
+
+//$ ----- Bricks.toml ----- //
+// Per-type brick values, bound once per type section ([normal], [strong], ...)
+struct BrickArchetype
+{
+    int scoreValue{ 0 };
+    int healthMax{ 0 };
+    sf::Color color{ sf::Color::Magenta };
+
+    static constexpr std::array<ConfigField<BrickArchetype>, 3> Fields{ {
+        { "", "scoreValue", &BrickArchetype::scoreValue },
+        { "", "healthMax",  &BrickArchetype::healthMax },
+        { "", "{}RGB",      &BrickArchetype::color },
+    } };
+};
+
+struct BricksConfig
+{
+    // Indexed by BrickType
+    std::array<BrickArchetype, BrickTypeCount> archetypes{};
+    // A Strong brick that took a hit
+    sf::Color strongDamagedColor{ sf::Color::Magenta };
+
+    static constexpr std::array<ConfigField<BricksConfig>, 1> Fields{ {
+        { "strongDamaged", "strongDamagedRGB", &BricksConfig::strongDamagedColor },
+    } };
+
+    [[nodiscard]] const BrickArchetype& get(BrickType type) const
+    {
+        return archetypes[static_cast<std::size_t>(type)];
+    }
+};
+
+struct GameConfig
+{
+    WindowConfig window;
+    PlayerConfig player;
+    BallConfig ball;
+    BricksConfig bricks;
+
+    // Binds WindowConfig.toml (needed before the window exists)
+    void bindWindow(const ConfigManager& configManager);
+    // Binds Player, Ball and Bricks (all must be loaded). Levels come from the LevelPack.
+    void bindGameplay(const ConfigManager& configManager);
+};
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <toml++/toml.hpp>
+
+#include "Utilities/Logger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Declarative binding of config sections onto plain structs.
+// A struct lists its fields once (section, key, member); binding walks that table a
+// single time at load, fills the members and reports every missing or mistyped key
+// then. Missing keys keep the member's default. Gameplay code reads the struct after.
+//
+// An empty section means "the section passed to bind()" (for structs bound to several
+// sections, like one per brick type or level); "{}" in a key is replaced by that
+// section's name (e.g. "{}RGB" -> "normalRGB").
+template<typename Struct>
+struct ConfigField
+{
+    using Member = std::variant<
+        bool Struct::*,
+        int Struct::*,
+        unsigned int Struct::*,
+        float Struct::*,
+        std::string Struct::*,
+        sf::Color Struct::*,                // [r, g, b]
+        std::vector<std::string> Struct::*  // array of strings
+    >;
+
+    std::string_view section;
+    std::string_view key;
+    Member member;
+};
+
+namespace ConfigBinding
+{
+    namespace detail
+    {
+        template<typename T>
+        std::optional<T> read(toml::node_view<const toml::node> node)
+        {
+            if constexpr (std::is_same_v<T, sf::Color>)
+            {
+                const toml::array* rgb = node.as_array();
+                if (!rgb || rgb->size() != 3)
+                {
+                    return std::nullopt;
+                }
+                std::array<std::uint8_t, 3> channels{};
+                for (std::size_t i = 0; i < 3; ++i)
+                {
+                    std::optional<std::int64_t> channel = (*rgb)[i].value<std::int64_t>();
+                    if (!channel || *channel < 0 || *channel > 255)
+                    {
+                        return std::nullopt;
+                    }
+                    channels[i] = static_cast<std::uint8_t>(*channel);
+                }
+                return sf::Color(channels[0], channels[1], channels[2]);
+            }
+            else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+            {
+                const toml::array* items = node.as_array();
+                if (!items)
+                {
+                    return std::nullopt;
+                }
+                std::vector<std::string> result;
+                result.reserve(items->size());
+                for (const auto& item : *items)
+                {
+                    std::optional<std::string> text = item.value<std::string>();
+                    if (!text)
+                    {
+                        return std::nullopt;
+                    }
+                    result.push_back(std::move(*text));
+                }
+                return result;
+            }
+            else
+            {
+                return node.value<T>();
+            }
+        }
+    }
+
+    // Binds 'fields' from 'table' (config 'configID', for error messages) into 'out'.
+    // Returns false if any key was missing or had the wrong type.
+    template<typename Struct>
+    bool bind(const toml::table& table, std::string_view configID,
+              std::span<const ConfigField<Struct>> fields, Struct& out,
+              std::string_view section = {})
+    {
+        bool complete = true;
+
+        for (const ConfigField<Struct>& field : fields)
+        {
+            std::string_view fieldSection = field.section.empty() ? section : field.section;
+            std::string key = std::vformat(field.key, std::make_format_args(fieldSection));
+
+            auto node = fieldSection.empty() ? table[key] : table[fieldSection][key];
+
+            std::visit([&](auto member) {
+                using Value = std::remove_cvref_t<decltype(out.*member)>;
+
+                if (!node)
+                {
+                    logger::Warn(std::format("Config [{}] is missing [{}].{}; using the default.",
+                                             configID, fieldSection, key));
+                    complete = false;
+                    return;
+                }
+
+                if (std::optional<Value> value = detail::read<Value>(node))
+                {
+                    out.*member = std::move(*value);
+                }
+                else
+                {
+                    logger::Error(std::format("Config [{}] has an invalid value for [{}].{}; using the default.",
+                                              configID, fieldSection, key));
+                    complete = false;
+                }
+            }, field.member);
+        }
+
+        return complete;
+    }
+}
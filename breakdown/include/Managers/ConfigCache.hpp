@@ -0,0 +1,50 @@
+#pragma once
+
+#include <toml++/toml.hpp>
+
+#include "Utilities/FileStamp.hpp"
+#include "Utilities/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Parsed config tables in a flat binary file, so startup doesn't re-parse TOML.
+// Each entry is keyed by its source path and stamped with the source's mtime, size and
+// content hash: a matching mtime/size is trusted as is, otherwise the source is hashed
+// and only re-parsed if its contents actually changed.
+// The cache file is memory mapped on open(); entries are decoded straight from it.
+class ConfigCache
+{
+public:
+    // Maps the cache file; false (and an empty cache) if it's missing or invalid
+    bool open(std::string_view cachePath);
+
+    // The cached table for sourcePath, if it's still up to date
+    [[nodiscard]] std::optional<toml::table> load(std::string_view sourcePath);
+    // Records a freshly parsed table (written on save())
+    void store(std::string_view sourcePath, const toml::table& table);
+
+    // Rewrites the cache file if anything was stored/restamped since open()
+    bool save();
+
+private:
+    struct Entry
+    {
+        utils::FileStamp stamp;
+        // Either points into m_File or into 'owned'
+        std::span<const std::byte> data;
+        std::vector<std::byte> owned;
+    };
+
+private:
+    std::string m_Path;
+    utils::MappedFile m_File;
+    std::map<std::string, Entry, std::less<>> m_Entries;
+    bool m_Dirty{ false };
+};
@@ -2,12 +2,14 @@
 
 #include <toml++/toml.hpp>
 
+#include "Managers/ConfigCache.hpp"
 #include "Utilities/Logger.hpp"
 
 #include <optional>
 #include <string_view>
 #include <string>
 #include <map>
+#include <memory_resource>
 #include <format>
 #include <source_location>
 #include <vector>
@@ -20,13 +22,33 @@ public:
     ConfigManager& operator=(const ConfigManager&) = delete;
     ~ConfigManager() noexcept = default;
 
+    // Maps the binary config cache; loadConfig() uses it for sources that haven't changed
+    void openCache(std::string_view cachePath);
+    // Writes back anything that had to be parsed from TOML (call once configs are loaded)
+    void saveCache();
+
     void loadConfig(std::string_view configID, std::string_view filepath);
 
+    //$ ----- Hot reload ----- //
+    // Parses a TOML file without touching any ConfigManager state (safe on any thread)
+    [[nodiscard]] static std::optional<toml::table> parseFile(std::string_view filepath);
+    // Swaps in (or adds) a table parsed from filepath, and updates the cache
+    void replaceConfig(std::string_view configID, std::string_view filepath, toml::table table);
+    // ID of the config loaded from filepath, if any
+    [[nodiscard]] std::optional<std::string> findConfigID(std::string_view filepath) const;
+
+    [[nodiscard]] bool isLoaded(std::string_view configID) const
+    {
+        return m_ConfigFiles.contains(configID);
+    }
+
     [[nodiscard]] const toml::table* getConfigTable(std::string_view configID) const;
 
-    std::vector<std::string> getStringArray(
+    // Strings are allocated from 'resource' (e.g. a state arena), heap by default
+    std::pmr::vector<std::pmr::string> getStringArray(
         std::string_view configID, std::string_view section,
-        std::string_view key, 
+        std::string_view key,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
         const std::source_location& loc = std::source_location::current()) const;
 
     // getConfigValue requires (configID, key) or (configID, section, key)
@@ -44,6 +66,9 @@ public:
 
 private:
     std::map<std::string, toml::table, std::less<>> m_ConfigFiles;
+    // config ID -> source file
+    std::map<std::string, std::string, std::less<>> m_ConfigPaths;
+    ConfigCache m_Cache;
 
 };
 
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <SFML/Window/Event.hpp>
+
+#include "Utilities/InplaceFunction.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// What a subscriber did with an event: Consumed stops lower priority subscribers (and
+// the next bus, see Application::dispatchEvent) from seeing it
+enum class EventResult { Pass, Consumed };
+
+// Higher runs first; equal priorities run in subscription order
+namespace EventPriority
+{
+    // Observers that must see everything (input recording, instrumentation)
+    constexpr int Monitor = 1000;
+    // Application-wide keys and window events
+    constexpr int Global = 100;
+    constexpr int Default = 0;
+    // Only if nothing else took it
+    constexpr int Fallback = -100;
+}
+
+// Typed event bus: one subscriber table per SFML event type, filled when a state or
+// manager is set up and only walked on dispatch (no per-frame closures). dispatch()
+// visits the sf::Event once and runs that type's table in priority order.
+class EventBus
+{
+public:
+    template <typename Event>
+    using Handler = utils::InplaceFunction<EventResult(const Event&)>;
+
+    using SubscriptionId = std::uint32_t;
+
+    template <typename Event>
+    SubscriptionId subscribe(Handler<Event> handler, int priority = EventPriority::Default)
+    {
+        auto& table = tableFor<Event>();
+        SubscriptionId id = ++m_LastId;
+
+        // after every subscriber with the same or a higher priority
+        auto position = std::ranges::find_if(table, [priority](const Subscriber<Event>& subscriber) {
+            return subscriber.priority < priority;
+        });
+        table.insert(position, Subscriber<Event>{ std::move(handler), priority, id });
+        return id;
+    }
+
+    template <typename Event>
+    void unsubscribe(SubscriptionId id)
+    {
+        std::erase_if(tableFor<Event>(), [id](const Subscriber<Event>& subscriber) {
+            return subscriber.id == id;
+        });
+    }
+
+    // Returns true if a subscriber consumed the event
+    template <typename Event>
+    bool publish(const Event& event)
+    {
+        for (auto& subscriber : tableFor<Event>())
+        {
+            if (subscriber.handler(event) == EventResult::Consumed)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool dispatch(const sf::Event& event)
+    {
+        return event.visit([this](const auto& typedEvent) { return publish(typedEvent); });
+    }
+
+private:
+    template <typename Event>
+    struct Subscriber
+    {
+        Handler<Event> handler;
+        int priority;
+        SubscriptionId id;
+    };
+
+    template <typename Event>
+    using Table = std::vector<Subscriber<Event>>;
+
+    // Every sf::Event subtype; a type SFML adds fails to compile in dispatch() until it's listed
+    using Tables = std::tuple<
+        Table<sf::Event::Closed>,
+        Table<sf::Event::Resized>,
+        Table<sf::Event::FocusLost>,
+        Table<sf::Event::FocusGained>,
+        Table<sf::Event::TextEntered>,
+        Table<sf::Event::KeyPressed>,
+        Table<sf::Event::KeyReleased>,
+        Table<sf::Event::MouseWheelScrolled>,
+        Table<sf::Event::MouseButtonPressed>,
+        Table<sf::Event::MouseButtonReleased>,
+        Table<sf::Event::MouseMoved>,
+        Table<sf::Event::MouseMovedRaw>,
+        Table<sf::Event::MouseEntered>,
+        Table<sf::Event::MouseLeft>,
+        Table<sf::Event::JoystickButtonPressed>,
+        Table<sf::Event::JoystickButtonReleased>,
+        Table<sf::Event::JoystickMoved>,
+        Table<sf::Event::JoystickConnected>,
+        Table<sf::Event::JoystickDisconnected>,
+        Table<sf::Event::TouchBegan>,
+        Table<sf::Event::TouchMoved>,
+        Table<sf::Event::TouchEnded>,
+        Table<sf::Event::SensorChanged>>;
+
+    template <typename Event>
+    Table<Event>& tableFor() noexcept
+    {
+        return std::get<Table<std::remove_cvref_t<Event>>>(m_Tables);
+    }
+
+private:
+    Tables m_Tables;
+    SubscriptionId m_LastId{ 0 };
+};
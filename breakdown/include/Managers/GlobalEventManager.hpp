@@ -5,16 +5,12 @@
 
 #include <SFML/Window/Event.hpp>
 
-#include <functional>
+#include "Managers/EventBus.hpp"
 
 struct AppContext; // forward declaration
 
-struct ApplicationEvents
-{
-	std::function<void(const sf::Event::Closed&)> onClose;
-    std::function<void(const sf::Event::KeyPressed&)> onGlobalKeyPress;
-};
-
+// Owns the application-wide EventBus. Every polled event goes through it first; what
+// isn't consumed here goes on to the current state's bus (see Application::dispatchEvent).
 class GlobalEventManager
 {
 public:
@@ -23,9 +19,8 @@ public:
     GlobalEventManager& operator=(const GlobalEventManager&) = delete;
     ~GlobalEventManager() = default;
 
-    ApplicationEvents& getEventHandles() noexcept { return m_Events; }
-    const ApplicationEvents& getEventHandles() const noexcept { return m_Events; }
+    EventBus& getBus() noexcept { return m_Bus; }
 
 private:
-    ApplicationEvents m_Events;
-};
\ No newline at end of file
+    EventBus m_Bus;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <toml++/toml.hpp>
+
+#include "Utilities/FileWatcher.hpp"
+#include "Utilities/JobSystem.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct AppContext;
+
+// Config/level hot reload for iterating on Ball/Player/Bricks/Levels without a restart.
+// A FileWatcher thread notices the edits, the files are re-parsed on the JobSystem, and
+// poll() applies finished parses at the frame boundary: re-bind GameConfig, rebuild the
+// level pack, drop stale level snapshots and let the states update live entities.
+class HotReloader
+{
+public:
+    explicit HotReloader(AppContext& context);
+    HotReloader(const HotReloader&) = delete;
+    HotReloader& operator=(const HotReloader&) = delete;
+    ~HotReloader() = default;
+
+    void watch(std::string_view filepath);
+    bool start();
+
+    // Main thread, once per frame
+    void poll();
+
+private:
+    void apply(const std::string& filepath, toml::table table);
+
+private:
+    struct PendingParse
+    {
+        std::string filepath;
+        utils::JobHandle job;
+        // written by the job, read here once it's done
+        std::shared_ptr<std::optional<toml::table>> result;
+    };
+
+    AppContext& m_AppContext;
+    utils::FileWatcher m_Watcher;
+    std::vector<PendingParse> m_Pending;
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <SFML/Window/Keyboard.hpp>
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+// Keyboard state for the simulation, built from key events instead of polling
+// sf::Keyboard once per frame. Application stamps every press / release as it's polled
+// (FramePacer keeps polling while it waits out the frame), and each fixed simulation
+// step consumes exactly the events of its own time slice: a tap shorter than a frame
+// still registers, and a key held for half a step moves the paddle half as far.
+class InputBuffer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct KeyEvent
+    {
+        sf::Keyboard::Scancode key;
+        bool pressed;
+        Clock::time_point time;
+    };
+
+    // Main thread, from Application::dispatchEvent. Events older than PendingHorizon
+    // that no step has consumed (menus, pause...) are folded into the held keys.
+    void record(sf::Keyboard::Scancode key, bool pressed, Clock::time_point time = Clock::now());
+    // Focus lost: the window won't see the releases, so let go of everything (including
+    // presses no step has consumed yet)
+    void releaseAll(Clock::time_point time = Clock::now());
+
+    // Start of a simulation step covering [start, end): applies the events stamped before
+    // end. Older events (from while nothing was simulating, e.g. paused) only update
+    // which keys are held.
+    void beginStep(Clock::time_point start, Clock::time_point end);
+
+    // About the current step
+    // Presses / releases that happened during it, in order
+    [[nodiscard]] const std::vector<KeyEvent>& stepEvents() const noexcept { return m_StepEvents; }
+    [[nodiscard]] bool isHeld(sf::Keyboard::Scancode key) const noexcept;
+    // Went down during the step (even if it's already up again)
+    [[nodiscard]] bool wasPressed(sf::Keyboard::Scancode key) const noexcept;
+    // Share of the step the key was down, 0 to 1
+    [[nodiscard]] float heldFraction(sf::Keyboard::Scancode key) const noexcept;
+
+private:
+    static constexpr std::size_t KeyCount = sf::Keyboard::ScancodeCount;
+    // Well past anything a step covers, even after the backlog of a long frame
+    static constexpr Clock::duration PendingHorizon = std::chrono::seconds(1);
+
+    static bool isTracked(sf::Keyboard::Scancode key) noexcept;
+    // Applies the events stamped before time to the held keys only, like beginStep()
+    // does for events older than its step
+    void collapseBefore(Clock::time_point time);
+
+private:
+    // Not yet consumed by a step, in stamp order
+    std::vector<KeyEvent> m_Events;
+    std::vector<KeyEvent> m_StepEvents;
+
+    std::bitset<KeyCount> m_Held;
+    std::bitset<KeyCount> m_PressedThisStep;
+    std::array<Clock::time_point, KeyCount> m_HeldSince{};
+    std::array<float, KeyCount> m_HeldFraction{};
+};
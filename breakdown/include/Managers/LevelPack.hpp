@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Utilities/FileStamp.hpp"
+#include "Utilities/JobSystem.hpp"
+#include "Utilities/MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class ConfigManager;
+
+// One decoded level: a dense grid of brick archetype indices (BrickType) plus metadata
+struct LevelDef
+{
+    static constexpr std::uint8_t EmptyCell = 0xFF;
+
+    float brickWidth{ 120.0f };
+    float brickHeight{ 40.0f };
+    float descentSpeed{ 0.0f };
+    std::uint16_t columns{ 0 };
+    std::uint16_t rows{ 0 };
+    // rows * columns, row-major
+    std::vector<std::uint8_t> cells;
+
+    [[nodiscard]] std::uint8_t cell(std::size_t row, std::size_t column) const
+    {
+        return cells[row * columns + column];
+    }
+};
+
+// Levels.toml compiled into a binary pack (config/Levels.pack): a header with the
+// source's stamp, an index of per-level offsets and one packed record per level.
+// The pack is memory mapped and only the levels actually played are decoded, so the
+// number and size of levels doesn't cost anything at startup.
+// Prefetch jobs read the mapping: the JobSystem has to shut down before this goes away.
+class LevelPack
+{
+public:
+    LevelPack() = default;
+    LevelPack(const LevelPack&) = delete;
+    LevelPack& operator=(const LevelPack&) = delete;
+    ~LevelPack() = default;
+
+    // Maps packPath, (re)compiling it from sourcePath first if it's missing or stale.
+    // A pack without its source is used as is.
+    bool open(std::string_view packPath, std::string_view sourcePath, ConfigManager& configManager);
+
+    // Recompiles from the source's current config table (e.g. after a hot reload)
+    bool rebuild(ConfigManager& configManager, utils::JobSystem& jobs);
+
+    [[nodiscard]] int levelCount() const noexcept { return static_cast<int>(m_LevelCount); }
+    [[nodiscard]] const std::string& sourcePath() const noexcept { return m_SourcePath; }
+
+    // Decodes one level (1-based); only reads the mapping, so it's safe from any thread
+    [[nodiscard]] std::optional<LevelDef> decode(int levelNumber) const;
+
+    // Start decoding a level on a worker (e.g. the next one while a transition screen is up)
+    void prefetch(int levelNumber, utils::JobSystem& jobs);
+    // The level: from the prefetch if it's the one prefetched (waiting for it if needed),
+    // decoded right away otherwise. Main thread only, like prefetch().
+    [[nodiscard]] std::optional<LevelDef> acquire(int levelNumber, utils::JobSystem& jobs);
+
+    static bool compile(std::string_view sourcePath, std::string_view packPath,
+                        ConfigManager& configManager);
+
+private:
+    bool map(std::string_view packPath);
+    [[nodiscard]] std::optional<utils::FileStamp> packedSourceStamp() const;
+
+private:
+    std::string m_PackPath;
+    std::string m_SourcePath;
+    utils::MappedFile m_File;
+    std::uint32_t m_LevelCount{ 0 };
+
+    struct Prefetch
+    {
+        int levelNumber{ 0 };
+        utils::JobHandle job;
+        std::shared_ptr<std::optional<LevelDef>> result;
+    };
+    Prefetch m_Prefetch;
+};
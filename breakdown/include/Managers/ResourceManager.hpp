@@ -24,6 +24,7 @@ public:
     ~ResourceManager() = default;
 
     void loadAssetsFromManifest(std::string_view filepath);
+    void loadAssetsFromManifest(const toml::table& manifest);
 
     template<typename T>
     void loadResource(std::string_view id, std::string_view filepath);
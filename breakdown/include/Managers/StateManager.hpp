@@ -1,10 +1,19 @@
 #pragma once
 
+#include <SFML/System.hpp>
+
 #include "State.hpp"
 #include "AppContext.hpp"
+#include "Utilities/JobSystem.hpp"
 
 #include <vector>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
 
 enum class StateAction { None, Push, Pop, Replace };
 
@@ -26,17 +35,80 @@ public:
     void popState();
     void replaceState(std::unique_ptr<State> state);
 
-    void processPending();
+    // The suspended instance of a reusable state if there is one, otherwise a new one.
+    // Pass the result to pushState / replaceState as usual.
+    template <typename T>
+    std::unique_ptr<T> reuseOrCreate();
+
+    // For states with heavy setup: prepare runs on the JobSystem while the current state
+    // stays interactive, then commit builds the new state on the main thread from what
+    // was prepared and it replaces the current one. A LoadingState covers the wait if it
+    // takes longer than LoadingDelay. Any other state change cancels the switch.
+    void replaceStateWhenReady(std::function<void()> prepare,
+                               std::function<std::unique_ptr<State>()> commit);
+    // Also true while a cancelled preparation's job is still running: it keeps reading
+    // m_Config and friends until it's done, whether or not the result is used
+    [[nodiscard]] bool isPreparing() const noexcept;
+
+    // Applies queued push/pop/replace (and a finished preparation); returns true if the
+    // state stack changed
+    bool processPending();
+    // A push/pop/replace is queued for the next processPending()
+    [[nodiscard]] bool hasPendingChanges() const noexcept { return !m_PendingChanges.empty(); }
 
     State* getCurrentState() noexcept;
     const State* getCurrentState() const noexcept;
 
     void update(sf::Time deltaTime);
-    void render();
+    void render(RenderSnapshot& snapshot);
+
+    // Tells every state on the stack (not just the top one) that a config was hot reloaded
+    void onConfigReloaded(std::string_view configID);
 
 private:
+    // Shows the LoadingState / queues the commit; returns true if the stack changed
+    bool processPreparation();
+    void cancelPreparation();
+
+    void enterState(std::unique_ptr<State> state);
+    // Takes the top state off the stack: suspended if reusable, destroyed otherwise
+    void exitState();
+
+private:
+    struct Preparation
+    {
+        utils::JobHandle job;
+        std::function<std::unique_ptr<State>()> commit;
+        sf::Clock elapsed;
+        bool showingLoading{ false };
+    };
+
+    static constexpr sf::Time LoadingDelay = sf::milliseconds(100);
+
     std::vector<std::unique_ptr<State>> m_States;
     AppContext& m_AppContext;
 
     std::vector<PendingChange> m_PendingChanges;
-};
\ No newline at end of file
+    std::optional<Preparation> m_Preparation;
+    // Jobs of cancelled preparations that haven't finished yet
+    std::vector<utils::JobHandle> m_Cancelled;
+
+    // Reusable states that were taken off the stack, one per type
+    std::unordered_map<std::type_index, std::unique_ptr<State>> m_Suspended;
+};
+
+template <typename T>
+std::unique_ptr<T> StateManager::reuseOrCreate()
+{
+    static_assert(std::is_base_of_v<State, T>, "T must be a State");
+
+    auto it = m_Suspended.find(std::type_index(typeid(T)));
+    if (it == m_Suspended.end())
+    {
+        return std::make_unique<T>(m_AppContext);
+    }
+
+    std::unique_ptr<State> state = std::move(it->second);
+    m_Suspended.erase(it);
+    return std::unique_ptr<T>(static_cast<T*>(state.release()));
+}
\ No newline at end of file
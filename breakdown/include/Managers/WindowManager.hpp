@@ -2,7 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 
-#include "Managers/ConfigManager.hpp"
+#include "GameConfig.hpp"
 
 #include <memory>
 #include <string>
@@ -10,14 +10,13 @@
 class WindowManager
 {
 public:
-    WindowManager(ConfigManager& configManager);
+    explicit WindowManager(const WindowConfig& config);
     WindowManager(const WindowManager&) = delete;
     WindowManager& operator=(const WindowManager&) = delete;
     ~WindowManager();
 
-    // Returns true on success, false if config is invalid or MainWindow already exists
-    // May throw toml::type_error if config values have wrong types
-    bool createMainWindow(/* uses config file data */);
+    // Returns true on success, false if MainWindow already exists
+    bool createMainWindow(/* uses the WindowConfig */);
 
     // Returns true on success, false if MainWindow already exists
     bool createMainWindow(unsigned int width, unsigned int height, const std::string& title);
@@ -30,6 +29,6 @@ public:
 
 private:
     std::unique_ptr<sf::RenderWindow> m_MainWindow { nullptr };
-    ConfigManager& m_ConfigManager;
+    const WindowConfig& m_Config;
 
 };
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <span>
+
+// With the render thread on, it lays out and draws copied sf::Text while the main thread
+// records the next frame, and both go through the shared sf::Font. A glyph that isn't
+// loaded yet gets added to the font's glyph table and page texture (possibly resizing
+// it) by whoever needs it first, so every size text is drawn at is loaded up front
+// (Assets::TextSizes) and fonts are frozen after that: no new sizes or characters.
+namespace FontPreload
+{
+    // Printable ASCII at every size. Main thread, before any text is recorded
+    void preload(const sf::Font& font, std::span<const unsigned int> characterSizes);
+
+    [[nodiscard]] bool isPreloaded(const sf::Font& font, unsigned int characterSize);
+    // isPreloaded, logging an error the first time a size is missing.
+    // RenderSnapshot checks every text it records; main thread only, like preload()
+    bool check(const sf::Font& font, unsigned int characterSize);
+}
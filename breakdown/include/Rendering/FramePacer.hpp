@@ -0,0 +1,79 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+// How the main loop waits between frames (WindowConfig.toml [framePacing])
+enum class PacingMode
+{
+    Uncapped,   // no wait at all, for benchmarking
+    VSync,      // the driver blocks in display()
+    Hybrid      // sleep most of the interval, spin the rest on a steady clock
+};
+
+// Frame time statistics over the last FramePacer::HistorySize frames, in milliseconds
+struct FrameStats
+{
+    float meanMs{ 0.0f };
+    float stdDevMs{ 0.0f };
+    float minMs{ 0.0f };
+    float maxMs{ 0.0f };
+    std::size_t samples{ 0 };
+};
+
+// Paces the main loop and measures the frame times it achieves.
+// sf::Window::setFramerateLimit sleeps for the whole remainder of the frame and
+// inherits the scheduler's granularity (often 1-2 ms of jitter); the hybrid mode only
+// sleeps until spinMargin before the deadline and busy-waits the last stretch.
+class FramePacer
+{
+public:
+    static constexpr std::size_t HistorySize = 120;
+    static constexpr std::chrono::microseconds PollInterval{ 1000 };
+
+    FramePacer(PacingMode mode, unsigned int targetFps, std::chrono::microseconds spinMargin);
+
+    // Sets the window's vsync / framerate limit to match the mode. Call it while the
+    // window's context is active on the calling thread (i.e. before the Renderer takes it)
+    void apply(sf::RenderWindow& window) const;
+
+    // End of frame: waits for the next frame deadline (Hybrid) and records the frame time.
+    // pollEvents runs about every PollInterval while waiting, so input gets stamped when
+    // it happens rather than at the start of the next frame.
+    void endFrame(const std::function<void()>& pollEvents = {});
+    // Forget the current deadline and don't record the next interval, for when the
+    // loop was blocked on purpose (idle waiting) and the gap isn't a frame time
+    void resync() noexcept;
+
+    [[nodiscard]] FrameStats stats() const noexcept;
+    [[nodiscard]] PacingMode mode() const noexcept { return m_Mode; }
+
+    [[nodiscard]] static std::optional<PacingMode> parseMode(std::string_view name) noexcept;
+    [[nodiscard]] static std::string_view modeName(PacingMode mode) noexcept;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void waitUntil(Clock::time_point deadline, const std::function<void()>& pollEvents) const;
+    void record(Clock::time_point now) noexcept;
+
+private:
+    PacingMode m_Mode;
+    Clock::duration m_Period;
+    std::chrono::microseconds m_SpinMargin;
+
+    Clock::time_point m_NextDeadline{};
+    Clock::time_point m_LastFrame{};
+    bool m_HasLastFrame{ false };
+
+    // Ring buffer of frame times in milliseconds
+    std::array<float, HistorySize> m_History{};
+    std::size_t m_HistoryNext{ 0 };
+    std::size_t m_HistoryCount{ 0 };
+};
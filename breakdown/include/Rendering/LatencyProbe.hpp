@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Input-to-display latency, in milliseconds, over the last LatencyProbe::HistorySize inputs
+struct LatencyStats
+{
+    // key event -> the simulation step that consumed it
+    float meanToTickMs{ 0.0f };
+    // key event -> display() of the first frame recorded after that step
+    float meanMs{ 0.0f };
+    float p50Ms{ 0.0f };
+    float p95Ms{ 0.0f };
+    float p99Ms{ 0.0f };
+    float maxMs{ 0.0f };
+    std::size_t samples{ 0 };
+};
+
+// Instrumentation mode ([latencyProbe] in WindowConfig.toml) for judging pacing, vsync and
+// render thread choices. Each key event is stamped when it's polled (InputBuffer), tagged
+// with the step that consumed it, carried in the next RenderSnapshot and measured when the
+// Renderer's display() returns for that snapshot, on whichever thread draws.
+class LatencyProbe
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::size_t HistorySize = 512;
+
+    struct InputStamp
+    {
+        Clock::time_point input;
+        Clock::time_point consumed;
+        std::uint64_t tick;
+    };
+
+    // Main thread: a simulation step consumed an input stamped at inputTime
+    void onInputConsumed(Clock::time_point inputTime, std::uint64_t tick);
+    // Main thread: the inputs the frame being recorded reflects (clears the list)
+    void takeFrameInputs(std::vector<InputStamp>& out);
+
+    // Drawing thread, right after display()
+    void onPresented(std::span<const InputStamp> inputs, Clock::time_point presentTime);
+
+    [[nodiscard]] LatencyStats stats() const;
+
+    // Summary + histogram of every input measured this run. Returns false if the
+    // file couldn't be written.
+    bool writeReport(std::string_view filepath) const;
+
+private:
+    // Main thread only
+    std::vector<InputStamp> m_Pending;
+
+    mutable std::mutex m_Mutex;
+    // Ring buffer for the overlay
+    std::array<float, HistorySize> m_History{};
+    std::array<float, HistorySize> m_ToTickHistory{};
+    std::size_t m_HistoryNext{ 0 };
+    std::size_t m_HistoryCount{ 0 };
+    // Whole run, 1 ms buckets (the last one collects everything slower)
+    static constexpr std::size_t BucketCount = 100;
+    std::array<std::uint64_t, BucketCount> m_Histogram{};
+    std::uint64_t m_TotalSamples{ 0 };
+    double m_TotalMs{ 0.0 };
+    float m_MaxMs{ 0.0f };
+};
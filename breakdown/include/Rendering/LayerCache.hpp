@@ -0,0 +1,48 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+class RenderSnapshot;
+
+// A pre-recorded group of drawables (a state's static UI, a frozen playfield...) that the
+// renderer caches in a RenderTexture and draws as one quad. The content is immutable;
+// the owner hands over a new content + version when it changes.
+struct LayerRef
+{
+    std::uint64_t id{ 0 };
+    std::uint64_t version{ 0 };
+    // Texture size in pixels; a new size re-renders the layer (e.g. after a resize)
+    sf::Vector2u size{};
+    // What the texture is stretched over when drawn, in the target view's coordinates
+    sf::Vector2f area{};
+    std::shared_ptr<const RenderSnapshot> content{ nullptr };
+};
+
+// Layer textures, owned by whichever thread draws (the render thread when threaded).
+// A layer is only re-rendered when its version changes; layers nobody drew during
+// a frame are dropped at endFrame().
+class LayerCache
+{
+public:
+    // Texture holding the layer's content, rendering it first if it's out of date
+    const sf::Texture* getTexture(const LayerRef& layer);
+
+    void endFrame();
+
+    // Unique id for a new layer owner
+    static std::uint64_t nextLayerId();
+
+private:
+    struct Entry
+    {
+        std::unique_ptr<sf::RenderTexture> texture{ nullptr };
+        std::uint64_t version{ 0 };
+        bool used{ false };
+    };
+
+    std::unordered_map<std::uint64_t, Entry> m_Entries;
+};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/LayerCache.hpp"
+#include "Rendering/LatencyProbe.hpp"
+
+#include <cstddef>
+#include <variant>
+#include <vector>
+
+// Everything one frame draws, recorded by the simulation thread and replayed by the
+// Renderer (possibly on the render thread). Drawables are copied in, so the snapshot
+// doesn't point into the registry and stays valid while the next frame simulates.
+class RenderSnapshot
+{
+public:
+    // Starts a new frame; keeps the capacity from the last time this buffer was used
+    void clear();
+
+    void setView(const sf::View& view) { m_View = view; }
+    void setClearColor(sf::Color color) { m_ClearColor = color; }
+    [[nodiscard]] const sf::View& getView() const noexcept { return m_View; }
+
+    //$ ----- Recording ----- //
+    void draw(const sf::RectangleShape& shape);
+    void draw(const sf::CircleShape& shape);
+    void draw(const sf::Text& text);
+    void draw(const sf::Sprite& sprite);
+
+    // Untextured, outline-free rectangles (bricks) go into one vertex array and are
+    // drawn with a single call; anything else falls back to draw(shape)
+    void drawBatched(const sf::RectangleShape& shape);
+
+    // A cached layer, drawn as a single textured quad at the origin covering layer.area
+    void drawLayer(LayerRef layer);
+
+    //$ ----- Playback ----- //
+    // Clears target, applies the view and draws every item in recording order
+    void render(sf::RenderTarget& target, LayerCache& layers) const;
+    // Same, with a different view (e.g. the recorded one without its letterbox viewport)
+    void render(sf::RenderTarget& target, LayerCache& layers, const sf::View& view) const;
+
+    [[nodiscard]] std::size_t itemCount() const noexcept { return m_Items.size(); }
+
+    // Inputs this frame is the first to reflect (only filled with the LatencyProbe on)
+    [[nodiscard]] std::vector<LatencyProbe::InputStamp>& inputStamps() noexcept { return m_InputStamps; }
+    [[nodiscard]] const std::vector<LatencyProbe::InputStamp>& inputStamps() const noexcept { return m_InputStamps; }
+
+private:
+    // A run of consecutive batched quads in m_QuadVertices
+    struct QuadBatch
+    {
+        std::size_t firstVertex;
+        std::size_t vertexCount;
+    };
+
+    using RenderItem = std::variant<sf::RectangleShape, sf::CircleShape, sf::Text, sf::Sprite,
+                                    QuadBatch, LayerRef>;
+
+    sf::View m_View;
+    sf::Color m_ClearColor{ sf::Color::Black };
+    std::vector<RenderItem> m_Items;
+    std::vector<sf::Vertex> m_QuadVertices;
+    std::vector<LatencyProbe::InputStamp> m_InputStamps;
+};
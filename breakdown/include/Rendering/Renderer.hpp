@@ -0,0 +1,97 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/LayerCache.hpp"
+#include "Rendering/LatencyProbe.hpp"
+#include "Rendering/RenderSnapshot.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+struct RendererSettings
+{
+    // Draw on a render thread (see Renderer)
+    bool threaded{ true };
+    // Render the scene at this fixed size and upscale it to the window, so fill cost
+    // doesn't grow with the window. Unset: render at the window's resolution.
+    std::optional<sf::Vector2u> internalResolution{ std::nullopt };
+    // Linear filtering for the upscale; nearest otherwise
+    bool smoothUpscale{ false };
+};
+
+// Owns drawing to the main window.
+// Threaded: the window's GL context lives on a render thread that replays the newest
+// published RenderSnapshot while the main thread simulates the next frame. Snapshots
+// are triple buffered (writing / ready / drawing), and publishing waits only if the
+// render thread hasn't picked up the previous frame yet, so the simulation never runs
+// more than one frame ahead of the screen.
+// Single threaded: endFrame() draws the snapshot right away on the calling thread.
+// With an internal resolution the scene goes through an offscreen texture first.
+class Renderer
+{
+public:
+    Renderer(sf::RenderWindow& window, const RendererSettings& settings);
+    Renderer(const Renderer&) = delete;
+    Renderer& operator=(const Renderer&) = delete;
+    ~Renderer();
+
+    // Snapshot to record this frame into (cleared, with the current view set)
+    RenderSnapshot& beginFrame();
+    // Hand the recorded snapshot over for drawing
+    void endFrame();
+
+    // View used for every following frame; also what the main thread should use to
+    // map mouse coordinates (never read the window's own view while threaded)
+    void setView(const sf::View& view) { m_View = view; }
+    [[nodiscard]] const sf::View& getView() const noexcept { return m_View; }
+    // Pixels the view covers when drawn: its viewport in the window, or the internal
+    // resolution when upscaling. Size for anything pre-rendered to fill the view.
+    [[nodiscard]] sf::Vector2u getViewPixelSize() const;
+
+    // Stops the render thread before closing, since closing destroys the GL context.
+    // Use this instead of calling close() on the window directly.
+    void closeWindow();
+
+    [[nodiscard]] bool isThreaded() const noexcept { return m_Threaded; }
+
+    // Measure input latency at display(); set before the first frame, must outlive this
+    void setLatencyProbe(LatencyProbe* probe) noexcept { m_LatencyProbe = probe; }
+
+private:
+    void renderLoop();
+    void stopThread();
+    void present(const RenderSnapshot& snapshot);
+    // Scene into m_SceneTexture, then that texture scaled into the letterboxed view
+    void presentUpscaled(const RenderSnapshot& snapshot);
+
+private:
+    sf::RenderWindow& m_Window;
+    sf::View m_View;
+    bool m_Threaded;
+
+    // Only touched by whichever thread draws
+    LayerCache m_Layers;
+    std::optional<sf::Vector2u> m_InternalResolution;
+    // As configured; m_InternalResolution is dropped by the drawing thread if it fails
+    const std::optional<sf::Vector2u> m_ConfiguredResolution;
+    bool m_SmoothUpscale;
+    std::unique_ptr<sf::RenderTexture> m_SceneTexture{ nullptr };
+    LatencyProbe* m_LatencyProbe{ nullptr };
+
+    std::array<RenderSnapshot, 3> m_Snapshots;
+    std::size_t m_WriteIndex{ 0 };   // main thread only
+    std::size_t m_ReadyIndex{ 1 };   // guarded by m_Mutex
+    std::size_t m_DrawIndex{ 2 };    // render thread only
+    bool m_HasReady{ false };
+    bool m_Stopping{ false };
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    std::thread m_Thread;
+};
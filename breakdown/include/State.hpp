@@ -3,18 +3,20 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <SFML/Window/Event.hpp>
+#include <entt/entt.hpp>
 
 #include "AppContext.hpp"
+#include "ECS/SystemScheduler.hpp"
+#include "Managers/EventBus.hpp"
+#include "Rendering/RenderSnapshot.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
+#include "Utilities/InplaceFunction.hpp"
+#include "Utilities/MemoryArena.hpp"
 
-#include <functional>
+#include <cstdint>
+#include <memory>
 #include <optional>
-
-struct StateEvents
-{
-	std::function<void(const sf::Event::KeyPressed&)> onKeyPress = [](const auto&){};
-    std::function<void(const sf::Event::MouseButtonPressed&)> onMouseButtonPress = [](const auto&){};
-};
+#include <string_view>
 
 enum class TransitionType
 {
@@ -26,18 +28,54 @@ enum class TransitionType
 class State
 {
 public:
-    explicit State(AppContext& context) : m_AppContext(context) {}
+    explicit State(AppContext& context);
     virtual ~State() = default;
 
-    StateEvents& getEventHandlers() noexcept { return m_StateEvents; }
-    const StateEvents& getEventHandlers() const noexcept { return m_StateEvents; }
+    // Gets what the global bus didn't consume while this is the top state
+    EventBus& getEvents() noexcept { return m_Events; }
+
+    // Memory for UI data that lives as long as the state does
+    std::pmr::memory_resource* getStateArena() noexcept { return m_StateArena.resource(); }
+
+    // Entities owned by this state; they are all dropped with the state
+    entt::registry& getRegistry() noexcept { return m_Registry; }
+    const entt::registry& getRegistry() const noexcept { return m_Registry; }
+
+    // Re-test UI hover at the current mouse position (resize, becoming the top state)
+    void refreshHover();
 
     virtual void update(sf::Time deltaTime) = 0;
-    virtual void render() = 0;
+    // Record this state's drawables; layered states are recorded bottom to top
+    virtual void render(RenderSnapshot& snapshot) = 0;
+
+    // What StateManager calls: static states and states covered by another one are
+    // drawn from a cached layer (one quad), re-recorded only after markLayerDirty()
+    void renderLayer(RenderSnapshot& snapshot, bool covered);
+
+    // Everything on screen only changes with input events (no per-frame simulation or
+    // animation): the state is drawn from a cached layer and the main loop may idle
+    virtual bool isStatic() const noexcept { return false; }
+
+    // A config file was hot reloaded (AppContext::m_Config is already re-bound)
+    virtual void onConfigReloaded(std::string_view /* configID */) {}
+
+    // Put on / taken off the state stack (new or resumed / destroyed or suspended)
+    virtual void onEnter() {}
+    virtual void onExit() {}
+
+    // Taken off the stack, the state is suspended in StateManager instead of destroyed
+    // and handed out again by StateManager::reuseOrCreate() (entities, text layout and
+    // the recorded layer are kept)
+    virtual bool isReusable() const noexcept { return false; }
+
+protected:
+    void markLayerDirty() noexcept { m_LayerDirty = true; }
 
 protected:
     AppContext& m_AppContext;
-    StateEvents m_StateEvents;
+    EventBus m_Events;
+    utils::MemoryArena m_StateArena;
+    entt::registry m_Registry;
     
     sf::Vector2f getWindowCenter() const noexcept
     {
@@ -45,16 +83,27 @@ protected:
                                     m_AppContext.m_AppSettings.targetHeight };
         return { windowSize.x / 2.0f, windowSize.y / 2.0f };
     }
+
+private:
+    // registry signal hook for anything that changes how the UI looks
+    void onLayerContentChanged(entt::registry&, entt::entity) { markLayerDirty(); }
+
+private:
+    std::uint64_t m_LayerId;
+    std::uint64_t m_LayerVersion{ 0 };
+    std::shared_ptr<const RenderSnapshot> m_LayerContent{ nullptr };
+    bool m_LayerDirty{ true };
 };
 
 class MenuState : public State
 {
 public:
     explicit MenuState(AppContext& context);
-    virtual ~MenuState() override;
 
     virtual void update(sf::Time /* deltaTime */) override;
-    virtual void render() override;
+    virtual void render(RenderSnapshot& snapshot) override;
+    virtual bool isStatic() const noexcept override { return true; }
+    virtual bool isReusable() const noexcept override { return true; }
 
 private:
     std::optional<sf::Text> m_TitleText;
@@ -69,50 +118,95 @@ class SettingsMenuState : public State
 {
 public:
     explicit SettingsMenuState(AppContext& context, bool fromPlayState = false);
-    virtual ~SettingsMenuState() override;
 
     virtual void update(sf::Time /* deltaTime */) override;
-    virtual void render() override;
+    virtual void render(RenderSnapshot& snapshot) override;
+    virtual bool isStatic() const noexcept override { return true; }
+    virtual bool isReusable() const noexcept override { return true; }
+
+    // Where Back leads (PauseState or MenuState); set again whenever it's reused
+    void setFromPlayState(bool fromPlayState) noexcept { m_FromPlayState = fromPlayState; }
 
 private:
     sf::RectangleShape m_Background;
     std::optional<sf::Text> m_MusicVolumeText;
     std::optional<sf::Text> m_SfxVolumeText;
     bool m_FromPlayState;
+
+    // Set from AppSettings::changed, applied in update()
+    bool m_VolumeTextDirty{ false };
+    entt::scoped_connection m_SettingsConnection;
     
 private:
     void initMenuButtons();
     void assignStateEvents();
+    void onSettingsChanged(const AppSettings& settings);
 };
 
 class PlayState : public State
 {
 public:
     explicit PlayState(AppContext& context);
-    virtual ~PlayState() override;
+
+    // Switches to a PlayState for the current level. If its snapshot isn't cached yet,
+    // it's staged on a worker first and the current state stays up meanwhile.
+    static void load(AppContext& context);
 
     virtual void update(sf::Time deltaTime) override;
-    virtual void render() override;
+    virtual void render(RenderSnapshot& snapshot) override;
+    virtual void onConfigReloaded(std::string_view configID) override;
 
 private:
     sf::Music* m_Music{ nullptr };
     bool m_ShowDebug{ false };
+    // Frame pacing stats, shown with F12
+    std::optional<sf::Text> m_DebugText;
 
     // Descent mechanic data
     float m_DescentSpeed{ 10.0f };
+
+    // Simulation time not yet run as a fixed step
+    sf::Time m_StepAccumulator{ sf::Time::Zero };
+    std::uint64_t m_Tick{ 0 };
+
+    // Game systems, run in parallel where their declared access allows it
+    SystemScheduler m_Systems{ m_Registry };
+
+private:
+    void registerSystems();
+    void initDebugText();
+    void updateDebugText();
+};
+
+// Covers the screen while StateManager waits for a state to be prepared
+class LoadingState : public State
+{
+public:
+    explicit LoadingState(AppContext& context);
+
+    virtual void update(sf::Time deltaTime) override;
+    virtual void render(RenderSnapshot& snapshot) override;
+
+private:
+    std::optional<sf::Text> m_LoadingText;
+    sf::RectangleShape m_Backdrop;
+    sf::Time m_Elapsed{ sf::Time::Zero };
 };
 
 class PauseState : public State
 {
 public:
     explicit PauseState(AppContext& context);
-    virtual ~PauseState() override;
 
     virtual void update(sf::Time /* deltaTime */) override;
-    virtual void render() override;
+    virtual void render(RenderSnapshot& snapshot) override;
+    virtual bool isStatic() const noexcept override { return true; }
+    virtual bool isReusable() const noexcept override { return true; }
+    virtual void onEnter() override;
 
 private:
     std::optional<sf::Text> m_PauseText;
+    sf::Music* m_Music{ nullptr };
 };
 
 class GameTransitionState : public State
@@ -120,10 +214,10 @@ class GameTransitionState : public State
 public:
     explicit GameTransitionState(AppContext& context, 
                                 TransitionType type = TransitionType::LevelLoss);
-    virtual ~GameTransitionState() override;
 
     virtual void update(sf::Time /* deltaTime */) override;
-    virtual void render() override;
+    virtual void render(RenderSnapshot& snapshot) override;
+    virtual bool isStatic() const noexcept override { return true; }
 
 private:
     std::optional<sf::Text> m_TransitionText;
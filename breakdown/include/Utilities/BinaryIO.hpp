@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace utils
+{
+    // Flat binary encoding for caches we write and read back on the same machine:
+    // trivially copyable values in native byte order, strings as u32 length + bytes.
+
+    class BinaryWriter
+    {
+    public:
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        void write(const T& value)
+        {
+            const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+            m_Buffer.insert(m_Buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void writeString(std::string_view text)
+        {
+            write(static_cast<std::uint32_t>(text.size()));
+            writeBytes(std::as_bytes(std::span(text.data(), text.size())));
+        }
+
+        void writeBytes(std::span<const std::byte> bytes)
+        {
+            m_Buffer.insert(m_Buffer.end(), bytes.begin(), bytes.end());
+        }
+
+        [[nodiscard]] const std::vector<std::byte>& buffer() const noexcept { return m_Buffer; }
+        [[nodiscard]] std::vector<std::byte> release() noexcept { return std::move(m_Buffer); }
+
+    private:
+        std::vector<std::byte> m_Buffer;
+    };
+
+    // Bounds checked: reading past the end sets failed() and returns zeroes / empty,
+    // so callers can read a whole record and check once.
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(std::span<const std::byte> data) noexcept
+            : m_Data(data)
+        {
+        }
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        T read() noexcept
+        {
+            T value{};
+            if (!canRead(sizeof(T)))
+            {
+                return value;
+            }
+            std::memcpy(&value, m_Data.data() + m_Offset, sizeof(T));
+            m_Offset += sizeof(T);
+            return value;
+        }
+
+        // Points into the underlying data, valid as long as it is
+        std::string_view readString() noexcept
+        {
+            auto bytes = readBytes(read<std::uint32_t>());
+            return { reinterpret_cast<const char*>(bytes.data()), bytes.size() };
+        }
+
+        std::span<const std::byte> readBytes(std::size_t count) noexcept
+        {
+            if (!canRead(count))
+            {
+                return {};
+            }
+            auto bytes = m_Data.subspan(m_Offset, count);
+            m_Offset += count;
+            return bytes;
+        }
+
+        [[nodiscard]] bool failed() const noexcept { return m_Failed; }
+        [[nodiscard]] bool atEnd() const noexcept { return m_Offset == m_Data.size(); }
+
+    private:
+        bool canRead(std::size_t count) noexcept
+        {
+            if (m_Failed || count > m_Data.size() - m_Offset)
+            {
+                m_Failed = true;
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        std::span<const std::byte> m_Data;
+        std::size_t m_Offset{ 0 };
+        bool m_Failed{ false };
+    };
+
+    // 64-bit FNV-1a, to tell whether a source file's contents changed
+    [[nodiscard]] constexpr std::uint64_t hashBytes(std::span<const std::byte> bytes) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::byte byte : bytes)
+        {
+            hash ^= static_cast<std::uint64_t>(byte);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
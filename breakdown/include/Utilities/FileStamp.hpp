@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace utils
+{
+    // What a compiled/cached file remembers about its source to tell if it's stale
+    struct FileStamp
+    {
+        std::int64_t mtime{ 0 };
+        std::uint64_t size{ 0 };
+        std::uint64_t hash{ 0 };
+    };
+
+    // mtime and size only (cheap); hash is left 0
+    [[nodiscard]] std::optional<FileStamp> statFile(std::string_view filepath);
+    // FNV-1a of the whole file
+    [[nodiscard]] std::optional<std::uint64_t> hashFile(std::string_view filepath);
+
+    // True if the file at filepath still matches 'stamp': same mtime and size, or
+    // (touched but not edited) same size and contents
+    [[nodiscard]] bool fileMatches(std::string_view filepath, const FileStamp& stamp);
+}
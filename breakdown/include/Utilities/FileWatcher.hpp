@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Utilities/FileStamp.hpp"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+    // Watches a set of files from a background thread and collects the ones that
+    // changed; the owner picks them up with takeChanged() whenever it suits it (we do at
+    // the frame boundary). Linux uses inotify on the files' directories, so editors that
+    // save by writing a new file and renaming it over the old one are caught too.
+    // Elsewhere the files' stamps are polled.
+    class FileWatcher
+    {
+    public:
+        FileWatcher() = default;
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+        ~FileWatcher();
+
+        // Add files before start()
+        void watch(std::string_view filepath);
+        bool start();
+        void stop();
+
+        // Paths (as passed to watch()) changed since the last call, each listed once
+        [[nodiscard]] std::vector<std::string> takeChanged();
+
+    private:
+        void run();
+        void markChanged(const std::string& filepath);
+
+    private:
+        // normalized path -> path as given to watch()
+        std::map<std::string, std::string> m_Files;
+
+        std::atomic<bool> m_Stopping{ false };
+        std::thread m_Thread;
+
+        std::mutex m_Mutex;
+        std::vector<std::string> m_Changed;
+
+#ifdef __linux__
+        int m_Inotify{ -1 };
+        // watch descriptor -> normalized directory
+        std::map<int, std::string> m_Directories;
+#else
+        std::map<std::string, FileStamp> m_Stamps;
+#endif
+    };
+}
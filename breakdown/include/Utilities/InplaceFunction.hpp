@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace utils
+{
+    template <typename Signature, std::size_t Capacity = 2 * sizeof(void*)>
+    class InplaceFunction;
+
+    // Type-erased callable that never allocates: the callable is stored in a small
+    // inline buffer and called through a single function pointer.
+    // Only trivially copyable callables are accepted (lambdas capturing `this`, pointers,
+    // bools, ...), which keeps InplaceFunction itself trivially copyable. That makes
+    // components holding one cheap to move around in EnTT storage, and EventBus
+    // subscribers (one per handler, kept in priority order) cheap to shift on subscribe.
+    template <typename R, typename... Args, std::size_t Capacity>
+    class InplaceFunction<R(Args...), Capacity>
+    {
+    public:
+        InplaceFunction() noexcept = default;
+        InplaceFunction(std::nullptr_t) noexcept {}
+
+        template <typename F>
+            requires (!std::is_same_v<std::remove_cvref_t<F>, InplaceFunction>
+                      && std::is_invocable_r_v<R, std::remove_cvref_t<F>&, Args...>)
+        InplaceFunction(F&& callable) noexcept
+        {
+            using Callable = std::remove_cvref_t<F>;
+            static_assert(sizeof(Callable) <= Capacity,
+                          "Callable is too big for this InplaceFunction; capture less or raise Capacity");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t),
+                          "Callable is over-aligned for InplaceFunction");
+            static_assert(std::is_trivially_copyable_v<Callable>
+                          && std::is_trivially_destructible_v<Callable>,
+                          "InplaceFunction only stores trivially copyable callables (capture by pointer/value)");
+
+            ::new (static_cast<void*>(m_Storage)) Callable(std::forward<F>(callable));
+            m_Invoker = [](void* storage, Args... args) -> R
+            {
+                return std::invoke(*std::launder(reinterpret_cast<Callable*>(storage)),
+                                   std::forward<Args>(args)...);
+            };
+        }
+
+        // Precondition: holds a callable (check with operator bool)
+        R operator()(Args... args) const
+        {
+            assert(m_Invoker && "Calling an empty InplaceFunction");
+            return m_Invoker(m_Storage, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const noexcept { return m_Invoker != nullptr; }
+
+    private:
+        using Invoker = R (*)(void*, Args...);
+
+        Invoker m_Invoker = nullptr;
+        alignas(std::max_align_t) mutable std::byte m_Storage[Capacity]{};
+    };
+}
@@ -0,0 +1,214 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+    class JobSystem;
+    class TaskGraph;
+
+    // Where a job is allowed to run. MainThread jobs are only run from
+    // JobSystem::runMainThreadJobs() (or a wait() on the main thread), which is
+    // what anything touching the GL context / window has to use.
+    enum class JobAffinity
+    {
+        Any,
+        MainThread
+    };
+
+    namespace detail
+    {
+        struct Job
+        {
+            std::function<void()> task;
+            JobAffinity affinity{ JobAffinity::Any };
+
+            // Unfinished dependencies + 1 while the job is still being set up
+            std::atomic<int> pending{ 1 };
+            std::atomic<bool> done{ false };
+
+            std::mutex continuationMutex;
+            std::vector<std::shared_ptr<Job>> continuations;
+
+            // TaskGraph jobs are reset and run again: they keep their task, and their
+            // edges live in successors (released on every run) instead of continuations
+            bool reusable{ false };
+            std::vector<std::shared_ptr<Job>> successors;
+            // The TaskGraph the job belongs to, if any (see JobSystem::wait)
+            const void* graph{ nullptr };
+        };
+    }
+
+    // Reference to a scheduled job. Cheap to copy; an empty handle counts as done.
+    class JobHandle
+    {
+    public:
+        JobHandle() = default;
+
+        [[nodiscard]] bool isValid() const noexcept { return m_Job != nullptr; }
+        [[nodiscard]] bool isDone() const noexcept
+        {
+            return !m_Job || m_Job->done.load(std::memory_order_acquire);
+        }
+
+    private:
+        friend class JobSystem;
+        friend class TaskGraph;
+        explicit JobHandle(std::shared_ptr<detail::Job> job) : m_Job(std::move(job)) {}
+
+        std::shared_ptr<detail::Job> m_Job{ nullptr };
+    };
+
+    // Per-worker counters, read with JobSystem::getWorkerStats()
+    struct WorkerStats
+    {
+        std::chrono::nanoseconds busy{ 0 };
+        std::chrono::nanoseconds idle{ 0 };
+        std::uint64_t jobsRun{ 0 };
+        std::uint64_t jobsStolen{ 0 };
+    };
+
+    // Work-stealing thread pool.
+    // Every worker owns a deque: it pushes/pops its own work at the back and idle
+    // workers steal from the front of the others. Jobs scheduled from outside the
+    // pool are spread round robin over the worker deques.
+    class JobSystem
+    {
+    public:
+        // 0 workers = hardware concurrency - 1 (the main thread is the last "worker")
+        explicit JobSystem(std::size_t workerCount = 0);
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        // Finishes every queued (non main thread) job, joins the workers and logs the stats
+        ~JobSystem();
+
+        JobHandle schedule(std::function<void()> task, JobAffinity affinity = JobAffinity::Any);
+        // Queue a job for the main thread (GL / window work), run in runMainThreadJobs()
+        JobHandle scheduleOnMain(std::function<void()> task);
+
+        // Continuations: run task once every dependency has finished
+        JobHandle then(const JobHandle& dependency, std::function<void()> task,
+                       JobAffinity affinity = JobAffinity::Any);
+        JobHandle after(std::span<const JobHandle> dependencies, std::function<void()> task,
+                        JobAffinity affinity = JobAffinity::Any);
+
+        // Blocks until the job is done. Workers run other jobs in the meantime. The main
+        // thread only runs main thread jobs and the waited job itself (or the rest of its
+        // TaskGraph), so an unrelated long job can't stall the frame; otherwise it sleeps.
+        void wait(const JobHandle& handle);
+        void waitAll(std::span<const JobHandle> handles);
+
+        // Drain the main thread queue; Application::run calls this once per frame
+        void runMainThreadJobs();
+
+        [[nodiscard]] std::size_t getWorkerCount() const noexcept { return m_Workers.size(); }
+        [[nodiscard]] bool isMainThread() const noexcept;
+        [[nodiscard]] std::vector<WorkerStats> getWorkerStats() const;
+        void logStats() const;
+
+    private:
+        friend class TaskGraph;
+
+        struct alignas(64) Worker
+        {
+            std::thread thread;
+            mutable std::mutex queueMutex;
+            std::deque<std::shared_ptr<detail::Job>> queue;
+
+            std::atomic<std::int64_t> busyNs{ 0 };
+            std::atomic<std::int64_t> idleNs{ 0 };
+            std::atomic<std::uint64_t> jobsRun{ 0 };
+            std::atomic<std::uint64_t> jobsStolen{ 0 };
+        };
+
+        void workerLoop(std::size_t index);
+
+        std::shared_ptr<detail::Job> makeJob(std::function<void()> task, JobAffinity affinity);
+        void addDependency(const JobHandle& dependency, const std::shared_ptr<detail::Job>& job);
+        // Drops the "setup" reference (or a finished dependency); enqueues when it hits 0
+        void release(const std::shared_ptr<detail::Job>& job);
+        void enqueue(std::shared_ptr<detail::Job> job);
+        void execute(const std::shared_ptr<detail::Job>& job);
+
+        std::shared_ptr<detail::Job> popLocal(std::size_t index);
+        std::shared_ptr<detail::Job> steal(std::size_t thiefIndex);
+        std::shared_ptr<detail::Job> popMain();
+        // Takes waited (or another job of its graph) out of whichever worker queue it's in
+        std::shared_ptr<detail::Job> stealMatching(const detail::Job& waited);
+        // Run one queued job if there is one (used while a worker waits)
+        bool tryRunOne();
+        // Wakes a sleeping main thread wait(): a job finished or main thread work arrived
+        void notifyWaiters();
+
+    private:
+        std::vector<std::unique_ptr<Worker>> m_Workers;
+        std::thread::id m_MainThreadId;
+
+        std::mutex m_MainQueueMutex;
+        std::deque<std::shared_ptr<detail::Job>> m_MainQueue;
+
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+        std::mutex m_DoneMutex;
+        std::condition_variable m_DoneCondition;
+        std::atomic<std::size_t> m_Waiters{ 0 };
+        std::atomic<std::size_t> m_QueuedJobs{ 0 };
+        std::atomic<std::size_t> m_NextQueue{ 0 };
+        std::atomic<bool> m_Stopping{ false };
+    };
+
+    // Jobs plus the order they have to run in, submitted in one go.
+    // Build it once, call run() whenever the work is needed: the jobs are created on the
+    // first run and reset for the next ones, so a run allocates nothing.
+    // Don't add tasks / edges while a run is in flight.
+    class TaskGraph
+    {
+    public:
+        using NodeId = std::size_t;
+
+        TaskGraph() = default;
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+        ~TaskGraph();
+
+        NodeId addTask(std::function<void()> task, JobAffinity affinity = JobAffinity::Any);
+        // before has to finish before after starts
+        void precede(NodeId before, NodeId after);
+
+        // Schedules every task; the handle is done when all of them are.
+        // Waits for the previous run first if it is still going.
+        JobHandle run(JobSystem& jobs);
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_Nodes.size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_Nodes.empty(); }
+        void clear() noexcept;
+
+    private:
+        struct Node
+        {
+            std::function<void()> task;
+            JobAffinity affinity{ JobAffinity::Any };
+            std::vector<NodeId> dependsOn;
+        };
+
+        void buildJobs(JobSystem& jobs);
+        // Drops the jobs (and their edges, so a cycle can't keep them alive)
+        void resetJobs() noexcept;
+
+        std::vector<Node> m_Nodes;
+        std::vector<std::shared_ptr<detail::Job>> m_Jobs;
+        // Depends on every node; its handle is what run() returns
+        std::shared_ptr<detail::Job> m_Finished{ nullptr };
+    };
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace utils
+{
+    // Read-only memory mapping of a whole file. The OS pages it in on demand, so
+    // opening is cheap no matter the file size; data() stays valid until close().
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        // False if the file is missing, empty or can't be mapped
+        bool open(std::string_view filepath);
+        void close() noexcept;
+
+        [[nodiscard]] bool isOpen() const noexcept { return m_Data != nullptr; }
+        [[nodiscard]] std::span<const std::byte> data() const noexcept
+        {
+            return { static_cast<const std::byte*>(m_Data), m_Size };
+        }
+
+    private:
+        void* m_Data{ nullptr };
+        std::size_t m_Size{ 0 };
+#ifdef _WIN32
+        void* m_Mapping{ nullptr };
+#endif
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace utils
+{
+    // Monotonic (bump pointer) arena built on std::pmr.
+    // Allocations are never freed one by one; everything goes away at once on reset()
+    // or when the arena is destroyed. Hand resource() to std::pmr containers.
+    class MemoryArena
+    {
+    public:
+        explicit MemoryArena(std::size_t initialSize);
+        MemoryArena(const MemoryArena&) = delete;
+        MemoryArena& operator=(const MemoryArena&) = delete;
+        ~MemoryArena() = default;
+
+        // Releases every allocation made from this arena; the initial buffer is reused
+        // Anything still pointing into the arena is dangling after this!
+        void reset() noexcept;
+
+        [[nodiscard]] std::pmr::memory_resource* resource() noexcept { return &m_Resource; }
+        [[nodiscard]] std::size_t initialSize() const noexcept { return m_BufferSize; }
+
+    private:
+        std::size_t m_BufferSize;
+        std::unique_ptr<std::byte[]> m_Buffer;
+        std::pmr::monotonic_buffer_resource m_Resource;
+    };
+
+    // Arena sizes for the two lifetimes we use (they grow from the heap if exceeded)
+    namespace ArenaSizes
+    {
+        constexpr std::size_t Frame = 64 * 1024;
+        constexpr std::size_t State = 16 * 1024;
+    }
+}
@@ -1,23 +1,92 @@
 #pragma once
 
-#include <random>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <source_location>
+#include <span>
 
 namespace utils
 {
+    // xoshiro256** (Blackman & Vigna): 32 bytes of state and a handful of ALU ops per
+    // number. jump() / longJump() skip ahead 2^128 / 2^192 numbers, which is how one seed
+    // is split into non-overlapping streams. Usable with the <random> distributions.
+    class Xoshiro256
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        // The state is expanded from the seed with splitmix64, so any seed (even 0) is fine
+        explicit Xoshiro256(std::uint64_t seed = 0) noexcept;
+
+        static constexpr result_type min() noexcept { return 0; }
+        static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() noexcept
+        {
+            const std::uint64_t result = std::rotl(m_State[1] * 5, 7) * 9;
+            const std::uint64_t t = m_State[1] << 17;
+
+            m_State[2] ^= m_State[0];
+            m_State[3] ^= m_State[1];
+            m_State[1] ^= m_State[2];
+            m_State[0] ^= m_State[3];
+            m_State[2] ^= t;
+            m_State[3] = std::rotl(m_State[3], 45);
+
+            return result;
+        }
+
+        void jump() noexcept;
+        void longJump() noexcept;
+
+        [[nodiscard]] const std::array<std::uint64_t, 4>& state() const noexcept { return m_State; }
+
+    private:
+        void jump(const std::array<std::uint64_t, 4>& polynomial) noexcept;
+
+    private:
+        std::array<std::uint64_t, 4> m_State{};
+    };
+
+    // Seedable random numbers. The same seed + stream always gives the same sequence, so
+    // log getSeed() (or pass a fixed one) to reproduce a run. Give every system / worker
+    // thread its own stream (makeStream) instead of sharing one machine between threads.
     class RandomMachine
     {
     public:
+        // Seeded from std::random_device; the seed is logged
         RandomMachine();
+        // stream: small index (0, 1, 2...); each one is 2^192 numbers away from the last
+        explicit RandomMachine(std::uint64_t seed, std::uint64_t stream = 0);
         RandomMachine(const RandomMachine&) = delete;
         RandomMachine& operator=(const RandomMachine&) = delete;
+        RandomMachine(RandomMachine&&) noexcept = default;
+        RandomMachine& operator=(RandomMachine&&) noexcept = default;
         ~RandomMachine() = default;
 
+        void seed(std::uint64_t seed, std::uint64_t stream = 0);
+        [[nodiscard]] std::uint64_t getSeed() const noexcept { return m_Seed; }
+        [[nodiscard]] std::uint64_t getStream() const noexcept { return m_Stream; }
+
+        // Independent machine on the same seed
+        [[nodiscard]] RandomMachine makeStream(std::uint64_t stream) const;
+
+        // Both inclusive of min and max
         int getInt(int min, int max, int fallback = 0,
             const std::source_location& loc = std::source_location::current());
         float getFloat(float min, float max, float fallback = 0.0f,
             const std::source_location& loc = std::source_location::current());
 
+        // Batch versions for particles / procedural generation: four generator lanes are
+        // stepped side by side, which the compiler turns into SIMD code. Separate lanes
+        // from the single-value calls, so mixing both stays deterministic.
+        void fillInts(std::span<int> out, int min, int max, int fallback = 0,
+            const std::source_location& loc = std::source_location::current());
+        void fillFloats(std::span<float> out, float min, float max, float fallback = 0.0f,
+            const std::source_location& loc = std::source_location::current());
+
         int d2();
         int d4();
         int d6();
@@ -30,8 +99,19 @@ namespace utils
         float zeroToOne();
         float negOneToOne();
 
+    public:
+        static constexpr std::size_t LaneCount = 4;
+        // [state word][lane], so each state word of all lanes is one contiguous vector
+        using LaneState = std::array<std::array<std::uint64_t, LaneCount>, 4>;
+
+    private:
+        // Unbiased integer in [0, range) (Lemire's multiply-shift with rejection)
+        std::uint32_t bounded(std::uint32_t range) noexcept;
+
     private:
-        std::random_device m_RandomDevice;
-        std::mt19937 m_RandomEngine;
+        Xoshiro256 m_Engine;
+        alignas(32) LaneState m_Lanes{};
+        std::uint64_t m_Seed{ 0 };
+        std::uint64_t m_Stream{ 0 };
     };
-}
\ No newline at end of file
+}
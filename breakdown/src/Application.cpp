@@ -6,9 +6,13 @@
 #include "Utilities/Logger.hpp"
 #include "AssetKeys.hpp"
 #include "Utilities/Utils.hpp"
+#include "Rendering/FontPreload.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <format>
 #include <memory>
+#include <optional>
 
 Application::Application()
     : m_AppContext()
@@ -20,6 +24,7 @@ Application::Application()
 
     // Set the StateManager in AppContext to Application's StateManager
     m_AppContext.m_StateManager = &m_StateManager;
+    registerEventHandlers();
 
     // Push the initial application state
     auto menuState = std::make_unique<MenuState>(m_AppContext);
@@ -39,9 +44,23 @@ void Application::initMainWindow()
     if (m_AppContext.m_WindowManager->createMainWindow())
     {
         m_AppContext.m_MainWindow = &m_AppContext.m_WindowManager->getMainWindow();
-        m_AppContext.m_MainWindow->setFramerateLimit(60);
 
         logger::Info(std::format("Main window created."));
+
+        initFramePacing();
+
+        m_AppContext.m_Renderer = std::make_unique<Renderer>(*m_AppContext.m_MainWindow,
+                                                             loadRendererSettings());
+        if (m_AppContext.m_Config.window.latencyProbe)
+        {
+            m_AppContext.m_LatencyProbe = std::make_unique<LatencyProbe>();
+            m_AppContext.m_Renderer->setLatencyProbe(m_AppContext.m_LatencyProbe.get());
+            logger::Info("Latency probe enabled.");
+        }
+
+        // Idle loop timeouts (static states / unfocused window)
+        m_IdleTimeout = sf::milliseconds(m_AppContext.m_Config.window.idleTimeoutMs);
+        m_UnfocusedTimeout = sf::milliseconds(m_AppContext.m_Config.window.unfocusedTimeoutMs);
     }
     else 
     {
@@ -50,20 +69,104 @@ void Application::initMainWindow()
     }
 }
 
+void Application::initFramePacing()
+{
+    const WindowConfig& config = m_AppContext.m_Config.window;
+
+    std::optional<PacingMode> mode = FramePacer::parseMode(config.pacingMode);
+    if (!mode)
+    {
+        logger::Warn(std::format("Unknown frame pacing mode \"{}\"; using hybrid.", config.pacingMode));
+        mode = PacingMode::Hybrid;
+    }
+
+    m_AppContext.m_FramePacer = std::make_unique<FramePacer>(*mode,
+                                                             static_cast<unsigned int>(std::max(config.targetFps, 1)),
+                                                             std::chrono::microseconds(std::max(config.spinMarginUs, 0)));
+    // before the Renderer moves the window's context to its thread
+    m_AppContext.m_FramePacer->apply(*m_AppContext.m_MainWindow);
+
+    logger::Info(std::format("Frame pacing: {} ({} fps target).", FramePacer::modeName(*mode), config.targetFps));
+}
+
+RendererSettings Application::loadRendererSettings() const
+{
+    const WindowConfig& config = m_AppContext.m_Config.window;
+    RendererSettings settings;
+
+    settings.threaded = config.threadedRendering;
+    if (config.internalResolution)
+    {
+        if (config.internalWidth > 0 && config.internalHeight > 0)
+        {
+            settings.internalResolution = sf::Vector2u(config.internalWidth, config.internalHeight);
+        }
+        else
+        {
+            logger::Warn(std::format("Invalid internal resolution {}x{}; ignoring it.",
+                                     config.internalWidth, config.internalHeight));
+        }
+    }
+    settings.smoothUpscale = (config.upscaleFilter == "linear");
+
+    return settings;
+}
+
 void Application::initResources()
 {
-    m_AppContext.m_ResourceManager->loadAssetsFromManifest("config/AssetsManifest.toml");
-    m_AppContext.m_ConfigManager->loadConfig(Assets::Configs::Levels, "config/Levels.toml");
+    auto& configManager = *m_AppContext.m_ConfigManager;
+
+    configManager.loadConfig(Assets::Configs::Manifest, "config/AssetsManifest.toml");
+    if (const toml::table* manifest = configManager.getConfigTable(Assets::Configs::Manifest))
+    {
+        m_AppContext.m_ResourceManager->loadAssetsFromManifest(*manifest);
+    }
+    // Before any state records text: the render thread shares the fonts from here on
+    preloadFonts();
+    // Gameplay configs too: cheap from the cache, and the first Play click doesn't parse
+    configManager.loadConfig(Assets::Configs::Player, "config/Player.toml");
+    configManager.loadConfig(Assets::Configs::Ball, "config/Ball.toml");
+    configManager.loadConfig(Assets::Configs::Bricks, "config/Bricks.toml");
+
+    // Levels.toml is only parsed when the pack needs (re)compiling
+    m_AppContext.m_LevelPack->open("config/Levels.pack", "config/Levels.toml", configManager);
+
+    // Anything that had to be parsed goes into the cache for next launch
+    configManager.saveCache();
+
+    // Bind once; gameplay code reads m_Config from here on
+    m_AppContext.m_Config.bindGameplay(configManager);
+
+    if (m_AppContext.m_Config.window.hotReload)
+    {
+        m_HotReloader.watch("config/Player.toml");
+        m_HotReloader.watch("config/Ball.toml");
+        m_HotReloader.watch("config/Bricks.toml");
+        m_HotReloader.watch(m_AppContext.m_LevelPack->sourcePath());
+        m_HotReloader.start();
+    }
 
     // Set total number of levels for game
-    int totalLevels = m_AppContext.m_ConfigManager->getConfigValue<int>(
-                                Assets::Configs::Levels, "totalLevels").value_or(1);
+    int totalLevels = std::max(m_AppContext.m_LevelPack->levelCount(), 1);
     m_AppContext.m_AppData.totalLevels = totalLevels;
     
     logger::Info(std::format("Total number of levels available: {}", totalLevels));
     logger::Info("Resources initialized.");
 }
 
+void Application::preloadFonts()
+{
+    auto& resources = *m_AppContext.m_ResourceManager;
+    if (const sf::Font* font = resources.getResource<sf::Font>(Assets::Fonts::MainFont))
+    {
+        FontPreload::preload(*font, Assets::TextSizes::MainFont);
+    }
+    if (const sf::Font* font = resources.getResource<sf::Font>(Assets::Fonts::ScoreFont))
+    {
+        FontPreload::preload(*font, Assets::TextSizes::ScoreFont);
+    }
+}
+
 void Application::run()
 {
     if (!m_AppContext.m_MainWindow)
@@ -73,52 +176,149 @@ void Application::run()
     }
     
     sf::Clock mainClock = *m_AppContext.m_MainClock;
+    bool wasIdle = false;
+    // Events dispatched while the pacer waited; their effects haven't been drawn yet
+    bool dispatchedWhileWaiting = false;
 
     while (m_AppContext.m_MainWindow->isOpen())
     {
         sf::Time deltaTime = mainClock.restart();
-        m_StateManager.processPending();
-        processEvents();
-        update(deltaTime);
+        // time spent blocked in waitEvent isn't simulation time
+        if (wasIdle)
+        {
+            deltaTime = sf::Time::Zero;
+        }
+
+        m_AppContext.m_FrameArena->reset();
+        // GL / window work handed back from the workers
+        m_AppContext.m_JobSystem->runMainThreadJobs();
+        // Edited configs are applied here, between frames
+        m_HotReloader.poll();
+        bool stateChanged = m_StateManager.processPending();
+
+        State* currentState = m_StateManager.getCurrentState();
+        // a state being prepared has to be committed as soon as it's ready
+        bool idle = !stateChanged && !m_StateManager.isPreparing() && !dispatchedWhileWaiting
+                    && (!m_HasFocus || currentState->isStatic());
+        wasIdle = idle;
+
+        if (idle)
+        {
+            // Block until something happens; nothing happened -> nothing to update or redraw
+            sf::Time timeout = m_HasFocus ? m_IdleTimeout : m_UnfocusedTimeout;
+            bool gotEvents = waitForEvents(timeout);
+            // the blocked time isn't a frame time
+            m_AppContext.m_FramePacer->resync();
+            if (!gotEvents)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            processEvents();
+        }
+
+        // Unfocused: the game is frozen, static screens still apply their input
+        if (m_HasFocus || currentState->isStatic())
+        {
+            update(deltaTime);
+        }
         render();
+
+        // keep taking input while waiting for the next frame (see InputBuffer)
+        dispatchedWhileWaiting = false;
+        m_AppContext.m_FramePacer->endFrame([this, &dispatchedWhileWaiting]() {
+            dispatchedWhileWaiting |= processEvents();
+        });
+    }
+
+    if (m_AppContext.m_LatencyProbe)
+    {
+        m_AppContext.m_LatencyProbe->writeReport(m_AppContext.m_Config.window.latencyReportPath);
     }
 }
 
-void Application::processEvents()
+bool Application::processEvents()
 {
-    auto& globalEvents = m_AppContext.m_GlobalEventManager->getEventHandles();
-    auto& stateEvents = m_StateManager.getCurrentState()->getEventHandlers();
+    bool dispatched = false;
+    while (auto event = m_AppContext.m_MainWindow->pollEvent())
+    {
+        dispatchEvent(*event);
+        dispatched = true;
+    }
+    return dispatched;
+}
 
-    auto onKeyPressMerged = [&](const sf::Event::KeyPressed& event)
+bool Application::waitForEvents(sf::Time timeout)
+{
+    auto event = m_AppContext.m_MainWindow->waitEvent(timeout);
+    if (!event)
     {
-        // run global logic first
-        if (globalEvents.onGlobalKeyPress)
-        {
-            globalEvents.onGlobalKeyPress(event);
-        }
-        // then run state-specific
-        if (stateEvents.onKeyPress)
-        {
-            stateEvents.onKeyPress(event);
-        }
-    };
+        return false;
+    }
+
+    dispatchEvent(*event);
+    // and whatever else queued up behind it
+    processEvents();
+    return true;
+}
 
-    auto onResized = [&](const sf::Event::Resized& event)
+void Application::dispatchEvent(const sf::Event& event)
+{
+    if (m_AppContext.m_GlobalEventManager->getBus().dispatch(event))
     {
-        sf::Vector2f targetSize = {m_AppContext.m_AppSettings.targetWidth, 
-                                    m_AppContext.m_AppSettings.targetHeight};
+        return;
+    }
+    if (State* currentState = m_StateManager.getCurrentState())
+    {
+        currentState->getEvents().dispatch(event);
+    }
+}
+
+void Application::registerEventHandlers()
+{
+    EventBus& bus = m_AppContext.m_GlobalEventManager->getBus();
+
+    // Every key event feeds the simulation's input, whoever handles it afterwards
+    bus.subscribe<sf::Event::KeyPressed>([this](const sf::Event::KeyPressed& event) {
+        m_AppContext.m_Input->record(event.scancode, true);
+        return EventResult::Pass;
+    }, EventPriority::Monitor);
+    bus.subscribe<sf::Event::KeyReleased>([this](const sf::Event::KeyReleased& event) {
+        m_AppContext.m_Input->record(event.scancode, false);
+        return EventResult::Pass;
+    }, EventPriority::Monitor);
+
+    bus.subscribe<sf::Event::Resized>([this](const sf::Event::Resized& event) {
+        onResized(event);
+        return EventResult::Pass;
+    }, EventPriority::Global);
 
-        sf::View view(sf::FloatRect({0.0f, 0.0f}, targetSize));
-        utils::boxView(view, event.size.x, event.size.y);
-        m_AppContext.m_MainWindow->setView(view);
-    };
+    bus.subscribe<sf::Event::FocusLost>([this](const sf::Event::FocusLost&) {
+        m_HasFocus = false;
+        m_AppContext.m_Input->releaseAll();
+        logger::Info("Window lost focus; throttling.");
+        return EventResult::Pass;
+    }, EventPriority::Global);
+    bus.subscribe<sf::Event::FocusGained>([this](const sf::Event::FocusGained&) {
+        m_HasFocus = true;
+        logger::Info("Window regained focus.");
+        return EventResult::Pass;
+    }, EventPriority::Global);
+}
+
+void Application::onResized(const sf::Event::Resized& event)
+{
+    sf::Vector2f targetSize = {m_AppContext.m_AppSettings.targetWidth, 
+                                m_AppContext.m_AppSettings.targetHeight};
 
-    m_AppContext.m_MainWindow->handleEvents(
-        globalEvents.onClose,
-        onKeyPressMerged,
-        stateEvents.onMouseButtonPress,
-        onResized
-    );
+    sf::View view(sf::FloatRect({0.0f, 0.0f}, targetSize));
+    utils::boxView(view, event.size.x, event.size.y);
+    // the render thread applies it with the next published frame
+    m_AppContext.m_Renderer->setView(view);
+    // letterboxing moved the UI under the mouse
+    m_StateManager.getCurrentState()->refreshHover();
 }
 
 void Application::update(sf::Time deltaTime)
@@ -128,9 +328,14 @@ void Application::update(sf::Time deltaTime)
 
 void Application::render()
 {
-    m_AppContext.m_MainWindow->clear(sf::Color::Black);
+    // Record this frame; it's drawn while the next one simulates (see Renderer)
+    RenderSnapshot& snapshot = m_AppContext.m_Renderer->beginFrame();
 
-    m_StateManager.render();
+    m_StateManager.render(snapshot);
+    if (m_AppContext.m_LatencyProbe)
+    {
+        m_AppContext.m_LatencyProbe->takeFrameInputs(snapshot.inputStamps());
+    }
 
-    m_AppContext.m_MainWindow->display();
+    m_AppContext.m_Renderer->endFrame();
 }
\ No newline at end of file
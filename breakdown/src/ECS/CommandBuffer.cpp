@@ -0,0 +1,59 @@
+#include <entt/entt.hpp>
+
+#include "ECS/CommandBuffer.hpp"
+
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+void CommandBuffer::destroy(entt::entity entity)
+{
+    std::lock_guard lock(m_Mutex);
+    m_Destroyed.push_back(entity);
+}
+
+void CommandBuffer::defer(std::function<void(entt::registry&)> command)
+{
+    std::lock_guard lock(m_Mutex);
+    m_Commands.push_back(std::move(command));
+}
+
+void CommandBuffer::apply(entt::registry& registry)
+{
+    std::vector<entt::entity> destroyed;
+    std::vector<std::function<void(entt::registry&)>> commands;
+    {
+        std::lock_guard lock(m_Mutex);
+        destroyed.swap(m_Destroyed);
+        commands.swap(m_Commands);
+    }
+
+    for (auto entity : destroyed)
+    {
+        // the same entity can be recorded twice (e.g. two balls on one brick)
+        if (registry.valid(entity))
+        {
+            registry.destroy(entity);
+        }
+    }
+
+    for (auto& command : commands)
+    {
+        command(registry);
+    }
+
+    // hand the capacity back so recording doesn't reallocate every frame
+    std::lock_guard lock(m_Mutex);
+    if (m_Destroyed.empty())
+    {
+        destroyed.clear();
+        m_Destroyed.swap(destroyed);
+    }
+}
+
+bool CommandBuffer::empty() const
+{
+    std::lock_guard lock(m_Mutex);
+    return m_Destroyed.empty() && m_Commands.empty();
+}
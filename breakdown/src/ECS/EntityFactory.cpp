@@ -4,34 +4,49 @@
 
 #include "ECS/EntityFactory.hpp"
 #include "ECS/Components.hpp"
+#include "ECS/Systems.hpp"
 #include "SFML/System/Vector2.hpp"
 #include "Utilities/Utils.hpp"
 #include "Utilities/Logger.hpp"
 #include "AppContext.hpp"
 #include "AssetKeys.hpp"
+#include "ECS/LevelSnapshot.hpp"
+#include "Managers/ConfigManager.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
+#include <memory_resource>
 
-// functions for the ECS system
-namespace EntityFactory
+namespace
 {
-    //$ --- Player ---
-    // the player is a paddle, of course
-    entt::entity createPlayer(AppContext& context)
+    // Grow each pool once so bulk inserts don't reallocate brick by brick
+    template<typename... Types>
+    void reservePools(entt::registry& registry, std::size_t count)
     {
-        auto& registry = *context.m_Registry;
-        auto playerEntity = registry.create();
+        (registry.storage<Types>().reserve(registry.storage<Types>().size() + count), ...);
+    }
+
+    UIText makeScoreText(sf::Font& font, unsigned int size, const sf::Color& color,
+                         sf::Vector2f position)
+    {
+        UIText scoreText{ sf::Text(font, "Score: 0", size) };
+        scoreText.text.setFillColor(color);
+        utils::centerOrigin(scoreText.text);
+        scoreText.text.setPosition(position);
 
-        // Load config values
-        context.m_ConfigManager->loadConfig(Assets::Configs::Player, "config/Player.toml");
+        return scoreText;
+    }
 
-        float moveSpeed = context.m_ConfigManager->getConfigValue<float>(
-                          Assets::Configs::Player, "player", "movementSpeed").value_or(350.0f);
-        float paddleWidth = context.m_ConfigManager->getConfigValue<float>(
-                            Assets::Configs::Player, "player", "paddleWidth").value_or(140.0f);
-        float paddleHeight = context.m_ConfigManager->getConfigValue<float>(
-                            Assets::Configs::Player, "player", "paddleHeight").value_or(20.0f);
+    //$ --- Staging: read configs into a LevelSnapshot --- //
+    void stagePlayer(AppContext& context, LevelSnapshot& snapshot)
+    {
+        const PlayerConfig& config = context.m_Config.player;
 
         // Player paddle properties
         // Starting position
@@ -39,142 +54,239 @@ namespace EntityFactory
         auto paddleYPosition = context.m_AppSettings.targetHeight - 50.0f;
         sf::Vector2f playerPosition = sf::Vector2f(windowCenterX, paddleYPosition);
 
-        sf::Vector2f paddleSize = sf::Vector2f(paddleWidth, paddleHeight);
-        sf::Color paddleColor = utils::loadColorFromConfig(*context.m_ConfigManager,
-                                Assets::Configs::Player, "player", "paddleRGB");
+        sf::Vector2f paddleSize = sf::Vector2f(config.paddleWidth, config.paddleHeight);
+
+        snapshot.paddle.emplace(paddleSize, config.paddleColor, playerPosition);
+        snapshot.paddleSpeed = { config.movementSpeed };
+        snapshot.paddleConfine = { 1.0f, 1.0f };
+    }
 
-        Paddle playerPaddle(paddleSize, paddleColor, playerPosition);
+    void stageBall(AppContext& context, LevelSnapshot& snapshot, const Paddle* paddle)
+    {
+        const BallConfig& config = context.m_Config.ball;
+
+        // Calculate ballStartingPosition from Player Position
+        sf::Vector2f ballStartingPosition{ 0.0f, 0.0f };
+        if (paddle)
+        {
+            const auto& playerPosition = paddle->shape.getPosition();
+            float ballStartX = playerPosition.x;
+            float ballStartY = playerPosition.y - paddle->shape.getSize().y / 2.0f - config.radius;
+
+            ballStartingPosition = sf::Vector2f(ballStartX, ballStartY);
+        }
+
+        snapshot.ball.emplace(config.radius, config.color, ballStartingPosition);
+        snapshot.ballSpeed = { config.speed };
+    }
+
+    void stageBricks(AppContext& context, LevelSnapshot& snapshot, const LevelDef& level)
+    {
+        snapshot.descentSpeed = level.descentSpeed;
+
+        sf::Vector2f startPos{ 10.0f, 10.0f };
+        sf::Vector2f brickSize{ level.brickWidth, level.brickHeight };
+        float padding = 5.0f;
+
+        // First pass: count bricks per archetype so everything can be sized up front
+        std::array<std::size_t, BrickTypeCount> archetypeCounts{};
+        std::size_t brickCount = 0;
+        for (std::uint8_t cell : level.cells)
+        {
+            if (cell < BrickTypeCount)
+            {
+                ++archetypeCounts[cell];
+                ++brickCount;
+            }
+        }
+
+        // Archetype copies happen once per type in use, not once per brick
+        std::array<BrickArchetype, BrickTypeCount> archetypes{};
+        for (std::size_t i = 0; i < BrickTypeCount; ++i)
+        {
+            if (archetypeCounts[i] > 0)
+            {
+                archetypes[i] = EntityFactory::loadBrickArchetype(context,
+                                                                  static_cast<BrickType>(i));
+            }
+        }
+
+        // Second pass: stage components in layout (row-major) order so the bricks end up
+        // contiguous and spatially ordered in their pools
+        snapshot.brickTypes.reserve(brickCount);
+        snapshot.bricks.reserve(brickCount);
+        snapshot.brickScores.reserve(brickCount);
+        snapshot.brickHealths.reserve(brickCount);
+
+        for (std::size_t row = 0; row < level.rows; ++row)
+        {
+            for (std::size_t col = 0; col < level.columns; ++col)
+            {
+                std::uint8_t cell = level.cell(row, col);
+                if (cell >= BrickTypeCount)
+                {
+                    continue;
+                }
+                auto type = static_cast<BrickType>(cell);
+
+                sf::Vector2f pos{};
+                pos.x = startPos.x + col * (brickSize.x + padding);
+                pos.y = startPos.y + row * (brickSize.y + padding);
+
+                const auto& archetype = archetypes[cell];
+                snapshot.brickTypes.push_back(type);
+                snapshot.bricks.emplace_back(brickSize, archetype.color, pos);
+                snapshot.brickScores.push_back({ archetype.scoreValue });
+                snapshot.brickHealths.push_back({ archetype.healthMax, archetype.healthMax });
+            }
+        }
+    }
+
+    void stageScoreDisplay(AppContext& context, LevelSnapshot& snapshot)
+    {
+        sf::Font* scoreFont = context.m_ResourceManager->getResource<sf::Font>(
+                                                               Assets::Fonts::ScoreFont);
+        if (!scoreFont)
+        {
+            logger::Error("Couldn't load ScoreFont! Score Display will not be created.");
+            return;
+        }
+
+        unsigned int scoreFontSize{ 32 };
+        sf::Vector2f scorePosition({ context.m_AppSettings.targetWidth / 2.0f,
+                                     context.m_AppSettings.targetHeight - 20.0f });
+
+        snapshot.scoreText = makeScoreText(*scoreFont, scoreFontSize, sf::Color::White,
+                                           scorePosition);
+    }
+
+    //$ --- Spawning: copy staged data into the registry --- //
+    void spawnBricks(entt::registry& registry, const LevelSnapshot& snapshot,
+                     std::pmr::memory_resource* scratch)
+    {
+        std::size_t brickCount = snapshot.bricks.size();
+        if (brickCount == 0)
+        {
+            return;
+        }
+
+        // Reserve once, then create and insert in bulk
+        reservePools<entt::entity, BrickTag, RenderableTag, BrickType,
+                     Brick, BrickScore, BrickHealth>(registry, brickCount);
+
+        std::pmr::vector<entt::entity> entities(brickCount, scratch);
+        registry.create(entities.begin(), entities.end());
+
+        registry.insert<BrickTag>(entities.begin(), entities.end());
+        registry.insert<RenderableTag>(entities.begin(), entities.end());
+        registry.insert<BrickType>(entities.begin(), entities.end(),
+                                   snapshot.brickTypes.begin());
+        registry.insert<Brick>(entities.begin(), entities.end(), snapshot.bricks.begin());
+        registry.insert<BrickScore>(entities.begin(), entities.end(),
+                                    snapshot.brickScores.begin());
+        registry.insert<BrickHealth>(entities.begin(), entities.end(),
+                                     snapshot.brickHealths.begin());
+    }
+
+    entt::entity spawnPlayer(entt::registry& registry, const LevelSnapshot& snapshot)
+    {
+        auto playerEntity = registry.create();
 
         // Add all components that make a "player"
         registry.emplace<PaddleTag>(playerEntity);  // way to ID the player
         registry.emplace<RenderableTag>(playerEntity);
-        registry.emplace<MovementSpeed>(playerEntity, moveSpeed);
+        registry.emplace<MovementSpeed>(playerEntity, snapshot.paddleSpeed);
         registry.emplace<Velocity>(playerEntity);
-        registry.emplace<Paddle>(playerEntity, playerPaddle);
-        registry.emplace<ConfineToWindow>(playerEntity, 1.0f, 1.0f);
-
-        logger::Info("Player paddle created.");
+        registry.emplace<Paddle>(playerEntity, *snapshot.paddle);
+        registry.emplace<ConfineToWindow>(playerEntity, snapshot.paddleConfine);
 
         return playerEntity;
     }
 
-    entt::entity createBall(AppContext& context)
+    entt::entity spawnBall(entt::registry& registry, const LevelSnapshot& snapshot)
     {
-        auto& registry = *context.m_Registry;
         auto ballEntity = registry.create();
 
-        // Load config values
-        context.m_ConfigManager->loadConfig(Assets::Configs::Ball, "config/Ball.toml");
+        registry.emplace<RenderableTag>(ballEntity);
+        registry.emplace<Ball>(ballEntity, *snapshot.ball);
+        registry.emplace<Velocity>(ballEntity);
+        registry.emplace<MovementSpeed>(ballEntity, snapshot.ballSpeed);
 
-        float ballRadius = context.m_ConfigManager->getConfigValue<float>(
-                           Assets::Configs::Ball, "ball", "ballRadius").value_or(25.0f);
-        float ballSpeed = context.m_ConfigManager->getConfigValue<float>(
-                          Assets::Configs::Ball, "ball", "ballSpeed").value_or(450.0f);
+        return ballEntity;
+    }
 
-        sf::Color ballColor = utils::loadColorFromConfig(*context.m_ConfigManager,
-                                Assets::Configs::Ball, "ball", "ballRGB");
+    entt::entity spawnScoreDisplay(entt::registry& registry, const UIText& scoreText)
+    {
+        auto scoreEntity = registry.create();
 
+        registry.emplace<HUDTag>(scoreEntity);
+        registry.emplace<ScoreHUDTag>(scoreEntity);
+        registry.emplace<CurrentScore>(scoreEntity, 0);
+        registry.emplace<UIText>(scoreEntity, scoreText);
 
-        // Calculate ballStartingPosition from Player Position
-        sf::Vector2f ballStartingPosition{ 0.0f, 0.0f };
+        return scoreEntity;
+    }
+}
+
+// functions for the ECS system
+namespace EntityFactory
+{
+    //$ --- Player ---
+    // the player is a paddle, of course
+    entt::entity createPlayer(AppContext& context, entt::registry& registry)
+    {
+        LevelSnapshot staged;
+        stagePlayer(context, staged);
+        auto playerEntity = spawnPlayer(registry, staged);
+
+        logger::Info("Player paddle created.");
+
+        return playerEntity;
+    }
+
+    entt::entity createBall(AppContext& context, entt::registry& registry)
+    {
+        // Start the ball on top of the player
+        const Paddle* paddle = nullptr;
         auto view = registry.view<PaddleTag, Paddle>();
         for (auto entity : view)
         {
-            const auto& playerShape = registry.get<Paddle>(entity).shape;
-            const auto& playerPosition = playerShape.getPosition();
-            float ballStartX = playerPosition.x;
-            float ballStartY = playerPosition.y - playerShape.getSize().y / 2.0f - ballRadius;
-
-            ballStartingPosition = sf::Vector2f(ballStartX, ballStartY);
+            paddle = &view.get<Paddle>(entity);
         }
 
-        Ball ballShape(ballRadius, ballColor, ballStartingPosition);
-
-        registry.emplace<RenderableTag>(ballEntity);
-        registry.emplace<Ball>(ballEntity, ballShape);
-        registry.emplace<Velocity>(ballEntity);
-        registry.emplace<MovementSpeed>(ballEntity, ballSpeed);
+        LevelSnapshot staged;
+        stageBall(context, staged, paddle);
+        auto ballEntity = spawnBall(registry, staged);
 
         logger::Info("Ball created.");
 
         return ballEntity;
     }
 
-    entt::entity createABrick(AppContext& context, sf::Vector2f size,
-                              sf::Vector2f position, BrickType type)
+    BrickArchetype loadBrickArchetype(AppContext& context, BrickType type)
+    {
+        return context.m_Config.bricks.get(type);
+    }
+
+    entt::entity createABrick(AppContext& context, entt::registry& registry,
+                              sf::Vector2f size, sf::Vector2f position, BrickType type)
     {
-        auto& registry = *context.m_Registry;
         auto brickEntity = registry.create();
 
+        BrickArchetype archetype = loadBrickArchetype(context, type);
+
         registry.emplace<BrickTag>(brickEntity);
         registry.emplace<RenderableTag>(brickEntity);
         registry.emplace<BrickType>(brickEntity, type);
-
-        // Placeholder values
-        sf::Color color = sf::Color::White;
-        int brickScoreValue = 0;
-        int brickHealthValue = 0;
-        int brickHealthMax = 0;
-
-        switch (type)
-        {
-            case BrickType::Normal:
-                brickScoreValue = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "normal", "scoreValue").value_or(5);
-                brickHealthMax = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "normal", "healthMax").value_or(1);
-                color = utils::loadColorFromConfig(*context.m_ConfigManager,
-                        Assets::Configs::Bricks, "normal", "normalRGB");
-                break;
-            case BrickType::Strong:
-                brickScoreValue = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "strong", "scoreValue").value_or(10);
-                brickHealthMax = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "strong", "healthMax").value_or(2);
-                color = utils::loadColorFromConfig(*context.m_ConfigManager,
-                        Assets::Configs::Bricks, "strong", "strongRGB");
-                break;
-            case BrickType::Gold:
-                brickScoreValue = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "gold", "scoreValue").value_or(20);
-                brickHealthMax = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "gold", "healthMax").value_or(1);
-                color = utils::loadColorFromConfig(*context.m_ConfigManager,
-                        Assets::Configs::Bricks, "gold", "goldRGB");
-                break;
-            case BrickType::Custom_1:
-                brickScoreValue = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "custom_1", "scoreValue").value_or(0);
-                brickHealthMax = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "custom_1", "healthMax").value_or(0);
-                color = utils::loadColorFromConfig(*context.m_ConfigManager,
-                        Assets::Configs::Bricks, "custom_1", "custom_1RGB");
-                break;
-            case BrickType::Custom_2:
-                brickScoreValue = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "custom_2", "scoreValue").value_or(0);
-                brickHealthMax = context.m_ConfigManager->getConfigValue<int>(
-                                  Assets::Configs::Bricks, "custom_2", "healthMax").value_or(0);
-                color = utils::loadColorFromConfig(*context.m_ConfigManager,
-                        Assets::Configs::Bricks, "custom_2", "custom_2RGB");
-                break;
-            default:
-                break;
-        }
-
-        brickHealthValue = brickHealthMax;
-
-        registry.emplace<Brick>(brickEntity, size, color, position);
-        registry.emplace<BrickScore>(brickEntity, brickScoreValue);
-        registry.emplace<BrickHealth>(brickEntity, brickHealthValue, brickHealthMax);
+        registry.emplace<Brick>(brickEntity, size, archetype.color, position);
+        registry.emplace<BrickScore>(brickEntity, archetype.scoreValue);
+        registry.emplace<BrickHealth>(brickEntity, archetype.healthMax, archetype.healthMax);
 
         return brickEntity;
     }
 
-    void createBricks(AppContext& context)
+    void createBricks(AppContext& context, entt::registry& registry)
     {
-        auto& registry = *context.m_Registry;
-        auto& window = *context.m_MainWindow;
         sf::Vector2f windowSize = { context.m_AppSettings.targetWidth,
                                     context.m_AppSettings.targetHeight };
 
@@ -209,121 +321,97 @@ namespace EntityFactory
                 brickPosition.y = spawnStartXY.y + (row * (brickSize.y + brickSpacing));
                 if (brick % 3 == 0)
                 {
-                    createABrick(context, brickSize, brickPosition, BrickType::Strong);
+                    createABrick(context, registry, brickSize, brickPosition, BrickType::Strong);
                 }
                 else if (brick % 5 == 0)
                 {
-                    createABrick(context, brickSize, brickPosition, BrickType::Gold);
+                    createABrick(context, registry, brickSize, brickPosition, BrickType::Gold);
                 }
                 else
                 {
-                    createABrick(context, brickSize, brickPosition, BrickType::Normal);
+                    createABrick(context, registry, brickSize, brickPosition, BrickType::Normal);
                 }
             }
         }
         logger::Info("Bricks created.");
     }
 
-    float loadLevel(AppContext& context, int levelNumber)
+    //$ --- Levels ---
+    const LevelSnapshot& getLevelSnapshot(AppContext& context, int levelNumber)
     {
-        std::string sectionName = std::format("level_{}", levelNumber);
-
-        context.m_ConfigManager->loadConfig(Assets::Configs::Bricks, "config/Bricks.toml");
-
-        float descentSpeed = context.m_ConfigManager->getConfigValue<float>(Assets::Configs::Levels,
-            sectionName, "descentSpeed"
-        ).value_or(0.0f);
-
-        std::vector<std::string> layout = context.m_ConfigManager->getStringArray(
-            Assets::Configs::Levels, sectionName, "layout"
-        );
-
-        if (layout.empty())
+        auto it = context.m_LevelSnapshots.find(levelNumber);
+        if (it != context.m_LevelSnapshots.end())
         {
-            logger::Error("Failed to load level layout: " + sectionName);
-            return 0.0f;
+            return it->second;
         }
 
-        sf::Vector2f startPos{ 10.0f, 10.0f };
+        // Decoded from the level pack (already done if it was prefetched)
+        std::optional<LevelDef> level = context.m_LevelPack->acquire(levelNumber, *context.m_JobSystem);
+        return storeLevelSnapshot(context, buildLevelSnapshot(context, levelNumber, level));
+    }
 
-        float brickWidth = context.m_ConfigManager->getConfigValue<float>(
-            Assets::Configs::Levels, sectionName, "brickWidth"
-        ).value_or(120.0f);
-        float brickHeight = context.m_ConfigManager->getConfigValue<float>(
-            Assets::Configs::Levels, sectionName, "brickHeight"
-        ).value_or(40.0f);
+    LevelSnapshot buildLevelSnapshot(AppContext& context, int levelNumber,
+                                     const std::optional<LevelDef>& level)
+    {
+        LevelSnapshot snapshot;
+        snapshot.levelNumber = levelNumber;
+        if (level)
+        {
+            stageBricks(context, snapshot, *level);
+        }
+        else
+        {
+            logger::Error(std::format("Failed to load level layout: level_{}", levelNumber));
+        }
+        stagePlayer(context, snapshot);
+        stageBall(context, snapshot, snapshot.paddle ? &*snapshot.paddle : nullptr);
 
-        sf::Vector2f brickSize{ brickWidth, brickHeight };
-        float padding = 5.0f;
+        logger::Info(std::format("Level {} snapshot built.", levelNumber));
 
-        for (size_t row = 0; row < layout.size(); ++row)
-        {
-            const std::string& rowStr = layout[row];
-            for (size_t col = 0; col < rowStr.size(); ++col)
-            {
-                char typeChar = rowStr[col];
+        return snapshot;
+    }
 
-                // . and ' ' are empty spaces
-                if (typeChar == '.' || typeChar == ' ')
-                {
-                    continue;
-                }
+    const LevelSnapshot& storeLevelSnapshot(AppContext& context, LevelSnapshot snapshot)
+    {
+        // sf::Text loads glyphs into the font's texture, so this part stays on the main thread
+        stageScoreDisplay(context, snapshot);
 
-                sf::Vector2f pos{};
-                pos.x = startPos.x + col * (brickSize.x + padding);
-                pos.y = startPos.y + row * (brickSize.y + padding);
+        int levelNumber = snapshot.levelNumber;
+        auto [inserted, _] = context.m_LevelSnapshots.insert_or_assign(levelNumber,
+                                                                      std::move(snapshot));
+        return inserted->second;
+    }
 
-                // build bricks
-                BrickType type = BrickType::Normal;
-                switch (typeChar)
-                {
-                    case 'S':
-                        type = BrickType::Strong;
-                        break;
-                    case 'G':
-                        type = BrickType::Gold;
-                        break;
-                    case 'N':
-                        type = BrickType::Normal;
-                        break;
-                    case 'X':
-                        type = BrickType::Custom_1;
-                        break;
-                    case 'Y':
-                        type = BrickType::Custom_2;
-                        break;
-                    default:
-                        type = BrickType::Normal;
-                        break;
-                }
+    void spawnLevel(AppContext& context, entt::registry& registry,
+                    const LevelSnapshot& snapshot)
+    {
+        spawnBricks(registry, snapshot, context.m_FrameArena->resource());
 
-                createABrick(context, brickSize, pos, type);
-            }
+        if (snapshot.paddle)
+        {
+            spawnPlayer(registry, snapshot);
+        }
+        if (snapshot.ball)
+        {
+            spawnBall(registry, snapshot);
+        }
+        if (snapshot.scoreText)
+        {
+            spawnScoreDisplay(registry, *snapshot.scoreText);
         }
 
-        logger::Info(std::format("Level {} loaded successfully. Level speed: {}",
-                                levelNumber, descentSpeed));
-
-        return descentSpeed;
+        logger::Info(std::format("Level {} loaded successfully. Bricks: {}, level speed: {}",
+                                snapshot.levelNumber, snapshot.bricks.size(),
+                                snapshot.descentSpeed));
     }
 
     //$ ----- HUD ----- //
-    entt::entity createScoreDisplay(AppContext &context, sf::Font& font,
+    entt::entity createScoreDisplay(entt::registry& registry, sf::Font& font,
                                     unsigned int size, const sf::Color& color,
                                     sf::Vector2f position)
     {
-        auto& registry = *context.m_Registry;
-        auto scoreEntity = registry.create();
-
-        registry.emplace<HUDTag>(scoreEntity);
-        registry.emplace<ScoreHUDTag>(scoreEntity);
-
-        registry.emplace<CurrentScore>(scoreEntity, 0);
-
-        auto& scoreText = registry.emplace<UIText>(scoreEntity, sf::Text(font, "Score: 0", size));
-        scoreText.text.setFillColor(color);
-        utils::centerOrigin(scoreText.text);
-        scoreText.text.setPosition(position);
+        auto scoreEntity = spawnScoreDisplay(registry,
+                                             makeScoreText(font, size, color, position));
 
         logger::Info("Score Display created.");
 
@@ -331,13 +419,11 @@ namespace EntityFactory
     }
 
     //$ ----- G/UI ----- //
-    entt::entity createButton(AppContext& context, sf::Font& font,
+    entt::entity createButton(entt::registry& registry, sf::Font& font,
                             const std::string& text, sf::Vector2f position,
-                            std::function<void()> action,
+                            utils::InplaceFunction<void()> action,
                             UITags tag, sf::Vector2f size)
     {
-        auto& registry = *context.m_Registry;
-
         auto buttonEntity = registry.create();
 
         switch (tag)
@@ -379,15 +465,15 @@ namespace EntityFactory
 
         // Clickable component
         registry.emplace<UIAction>(buttonEntity, std::move(action));
+        UISystems::applyHoverStyle(registry, buttonEntity, false);
 
         return buttonEntity;
     }
 
-    entt::entity createGUIButton(AppContext& context, sf::Texture& texture,
+    entt::entity createGUIButton(entt::registry& registry, sf::Texture& texture,
                                 sf::Vector2f position,
-                                std::function<void()> action, UITags tag)
+                                utils::InplaceFunction<void()> action, UITags tag)
     {
-        auto& registry = *context.m_Registry;
         auto buttonEntity = registry.create();
 
         switch (tag)
@@ -420,15 +506,15 @@ namespace EntityFactory
 
         // Clickable component
         registry.emplace<UIAction>(buttonEntity, std::move(action));
+        UISystems::applyHoverStyle(registry, buttonEntity, false);
 
         return buttonEntity;
     }
 
-    entt::entity createButtonLabel(AppContext& context, const entt::entity buttonEntity,
+    entt::entity createButtonLabel(entt::registry& registry, const entt::entity buttonEntity,
                                 sf::Font& font, const std::string& text,
                                 unsigned int size, const sf::Color& color, UITags tag)
     {
-        auto& registry = *context.m_Registry;
         auto labelEntity = registry.create();
         switch (tag)
         {
@@ -474,12 +560,11 @@ namespace EntityFactory
         return labelEntity;
     }
 
-    entt::entity createLabeledButton(AppContext &context, sf::Texture &texture,
-                                sf::Vector2f position, std::function<void ()> action,
+    entt::entity createLabeledButton(entt::registry& registry, sf::Texture &texture,
+                                sf::Vector2f position, utils::InplaceFunction<void()> action,
                                 sf::Font& font, UITags tag, const std::string& text,
                                 unsigned int size, const sf::Color& color)
     {
-        auto& registry = *context.m_Registry;
         auto buttonEntity = registry.create();
 
         switch (tag)
@@ -532,6 +617,7 @@ namespace EntityFactory
         labelPosition.y = buttonRect.position.y + (buttonRect.size.y / 2.0f);
 
         labelText.text.setPosition(labelPosition);
+        UISystems::applyHoverStyle(registry, buttonEntity, false);
 
         return buttonEntity;
     }
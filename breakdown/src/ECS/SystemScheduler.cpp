@@ -0,0 +1,70 @@
+#include <SFML/System.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/SystemScheduler.hpp"
+#include "AppContext.hpp"
+#include "Utilities/JobSystem.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <utility>
+
+namespace
+{
+    bool overlaps(const std::vector<entt::id_type>& first, const std::vector<entt::id_type>& second)
+    {
+        return std::ranges::any_of(first, [&second](entt::id_type id) {
+            return std::ranges::find(second, id) != second.end();
+        });
+    }
+}
+
+SystemScheduler::SystemScheduler(entt::registry& registry)
+    : m_Registry(registry)
+{
+}
+
+void SystemScheduler::run(AppContext& context, sf::Time deltaTime)
+{
+    SystemContext systemContext{ context, m_Registry, m_Commands, deltaTime };
+    m_RunContext = &systemContext;
+
+    // main thread helps out (and runs the main-thread-only systems) while waiting
+    context.m_JobSystem->wait(m_Graph.run(*context.m_JobSystem));
+    m_RunContext = nullptr;
+
+    //$ Sync point
+    m_Commands.apply(m_Registry);
+}
+
+void SystemScheduler::addEntry(SystemEntry entry)
+{
+    for (std::size_t i = 0; i < m_Systems.size(); ++i)
+    {
+        if (conflicts(m_Systems[i], entry))
+        {
+            entry.dependsOn.push_back(i);
+        }
+    }
+
+    // by index: m_Systems may still grow (and move) while systems are being added
+    std::size_t index = m_Systems.size();
+    auto node = m_Graph.addTask([this, index]() { m_Systems[index].system(*m_RunContext); },
+                                entry.affinity);
+    for (std::size_t dependency : entry.dependsOn)
+    {
+        m_Graph.precede(dependency, node);
+    }
+
+    logger::Info(std::format("Registered system \"{}\" ({} dependencies).",
+                             entry.name, entry.dependsOn.size()));
+    m_Systems.push_back(std::move(entry));
+}
+
+bool SystemScheduler::conflicts(const SystemEntry& first, const SystemEntry& second)
+{
+    return overlaps(first.writes, second.writes)
+        || overlaps(first.writes, second.reads)
+        || overlaps(first.reads, second.writes);
+}
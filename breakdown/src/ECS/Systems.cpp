@@ -5,6 +5,7 @@
 
 #include "ECS/Systems.hpp"
 #include "ECS/Components.hpp"
+#include "ECS/UIHoverIndex.hpp"
 #include "Managers/StateManager.hpp"
 #include "SFML/Graphics/Rect.hpp"
 #include "SFML/System/Vector2.hpp"
@@ -15,61 +16,110 @@
 #include "Utilities/Utils.hpp"
 
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
 #include <format>
 #include <string_view>
 
+namespace
+{
+    // State changes from inside a (possibly parallel) system go through the command buffer
+    void deferTransition(AppContext& context, CommandBuffer& commands, TransitionType type)
+    {
+        commands.defer([&context, type](entt::registry&) {
+            auto transitionState = std::make_unique<GameTransitionState>(context, type);
+            context.m_StateManager->replaceState(std::move(transitionState));
+        });
+    }
+
+    // Sounds touch AppData::activeSounds and SFML audio, so a worker queues them for
+    // the main thread instead of playing them
+    void deferSound(AppContext& context, CommandBuffer& commands, std::string_view soundID)
+    {
+        commands.defer([&context, soundID](entt::registry&) {
+            CoreSystems::playSound(context, soundID);
+        });
+    }
+
+    void markHoverIndexDirty(entt::registry& registry, entt::entity)
+    {
+        registry.ctx().get<UIHoverIndex>().markDirty();
+    }
+
+    void onHoverEnter(entt::registry& registry, entt::entity entity)
+    {
+        UISystems::applyHoverStyle(registry, entity, true);
+    }
+
+    void onHoverLeave(entt::registry& registry, entt::entity entity)
+    {
+        UISystems::applyHoverStyle(registry, entity, false);
+    }
+}
+
 namespace CoreSystems
 {
+    //$ Owning groups for the hot component sets
+    BallGroup ballGroup(entt::registry& registry)
+    {
+        return registry.group<Ball, Velocity, MovementSpeed>();
+    }
+
+    BrickGroup brickGroup(entt::registry& registry)
+    {
+        return registry.group<Brick, BrickHealth, BrickScore, BrickType>();
+    }
+
+    void registerGroups(entt::registry& registry)
+    {
+        ballGroup(registry);
+        brickGroup(registry);
+    }
+
     //$ "Core" / game systems (maybe rename...)
-    void handlePlayerInput(AppContext& context)
+    void handlePlayerInput(AppContext& context, entt::registry& registry)
     {
-        auto& registry = context.m_Registry;
         bool levelStarted = context.m_AppData.levelStarted;
+        const InputBuffer& input = *context.m_Input;
 
-        auto paddleView = registry->view<PaddleTag, Velocity, MovementSpeed>();
+        auto paddleView = registry.view<PaddleTag, Velocity, MovementSpeed>();
 
         for (auto paddleEntity : paddleView)
         {
             auto& velocity = paddleView.get<Velocity>(paddleEntity);
             const auto& speed = paddleView.get<MovementSpeed>(paddleEntity);
 
-            // Reset velocity
-            velocity.value = { 0.0f, 0.0f };
+            // Scaled by how much of this step each key was down
+            float direction = input.heldFraction(sf::Keyboard::Scan::D)
+                            - input.heldFraction(sf::Keyboard::Scan::A);
+            velocity.value = { direction * speed.value, 0.0f };
 
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::A))
-            {
-                velocity.value.x -= speed.value;
-            }
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::D))
-            {
-                velocity.value.x += speed.value;
-            }
-
-            if (!levelStarted && sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::Space))
+            bool launch = input.wasPressed(sf::Keyboard::Scan::Space)
+                       || input.isHeld(sf::Keyboard::Scan::Space);
+            if (!levelStarted && launch)
             {
                 playSound(context, Assets::SoundBuffers::PaddleHit);
 
                 context.m_AppData.levelStarted = true;
                 logger::Info("Level started.");
 
-                auto ballView = registry->view<Ball, Velocity, MovementSpeed>();
-                for (auto ballEntity : ballView)
+                for (auto [ballEntity, ball, ballVelocity, ballSpeed] : ballGroup(registry).each())
                 {
-                    auto& ballVelocity = ballView.get<Velocity>(ballEntity);
-                    auto& ballSpeed = ballView.get<MovementSpeed>(ballEntity);
                     ballVelocity.value = { velocity.value.x, -ballSpeed.value };
                 }
             }
         }
     }
 
-    void movementSystem(AppContext& context, sf::Time deltaTime)
+    void movementSystem(AppContext& context, entt::registry& registry, sf::Time deltaTime)
     {
-        auto& registry = context.m_Registry;
         bool levelStarted = context.m_AppData.levelStarted;
 
-        auto paddleView = registry->view<Paddle, Velocity>();
+        auto paddleView = registry.view<Paddle, Velocity>();
         for (auto paddleEntity : paddleView)
         {
             auto& paddleComp = paddleView.get<Paddle>(paddleEntity);
@@ -80,18 +130,14 @@ namespace CoreSystems
 
         if (levelStarted)
         {
-            auto ballView = registry->view<Ball, Velocity>();
-            for (auto ballEntity : ballView)
+            for (auto [ballEntity, ballShape, velocity, speed] : ballGroup(registry).each())
             {
-                auto& ballShape = ballView.get<Ball>(ballEntity);
-                const auto& velocity = ballView.get<Velocity>(ballEntity);
-
                 ballShape.shape.move(velocity.value * deltaTime.asSeconds());
             }
         }
         else
         {
-            auto paddleOnlyView = registry->view<Paddle>();
+            auto paddleOnlyView = registry.view<Paddle>();
             sf::Vector2f paddlePosition{};
             sf::Vector2f paddleSize{};
 
@@ -103,10 +149,8 @@ namespace CoreSystems
                 break;
             }
 
-            auto ballView = registry->view<Ball>();
-            for (auto ballEntity : ballView)
+            for (auto [ballEntity, ballComp, velocity, speed] : ballGroup(registry).each())
             {
-                auto& ballComp = ballView.get<Ball>(ballEntity);
                 float ballRadius = ballComp.shape.getRadius();
 
                 float x = paddlePosition.x;
@@ -118,34 +162,35 @@ namespace CoreSystems
 
     }
 
-    void collisionSystem(AppContext& context, sf::Time deltaTime)
+    void collisionSystem(AppContext& context, entt::registry& registry,
+                         CommandBuffer& commands, sf::Time deltaTime)
     {
-        auto& registry = context.m_Registry;
-        auto& window = context.m_MainWindow;
-        auto& stateManager = context.m_StateManager;
-
         sf::Vector2f windowSize = { context.m_AppSettings.targetWidth,
                                     context.m_AppSettings.targetHeight };
         bool triggerGameOver = false;
 
-        // Cache data structures
-        struct CachedBrick { entt::entity entity; sf::FloatRect bounds; };
-        static std::vector<CachedBrick> brickCache;
-        static std::vector<sf::FloatRect> paddleBoundsList;
+        // Cache data structures (scratch memory from the frame arena, gone next frame)
+        struct CachedBrick { entt::entity entity; sf::FloatRect bounds; BrickType type; };
+        std::pmr::memory_resource* frameMemory = context.m_FrameArena->resource();
+
+        auto bricks = brickGroup(registry);
+        auto paddleView = registry.view<Paddle, Velocity>();
 
-        // clear these each frame
-        brickCache.clear();
-        paddleBoundsList.clear();
+        std::pmr::vector<CachedBrick> brickCache(frameMemory);
+        std::pmr::vector<sf::FloatRect> paddleBoundsList(frameMemory);
+        brickCache.reserve(bricks.size());
+        // destroys are deferred, so count down ourselves to spot the last brick
+        std::size_t bricksLeft = bricks.size();
+        paddleBoundsList.reserve(paddleView.size_hint());
 
         //$ --- Paddle Collision Logic--- //
-        auto paddleView = registry->view<Paddle, Velocity>();
         for (auto paddleEntity : paddleView)
         {
             auto& paddleComp = paddleView.get<Paddle>(paddleEntity);
 
             //$ ----- Paddle vs Walls ----- //
             // Check for 'ConfineToWindow' and limit paddle to window
-            if (auto* bounds = registry->try_get<ConfineToWindow>(paddleEntity))
+            if (auto* bounds = registry.try_get<ConfineToWindow>(paddleEntity))
             {
                 auto paddleBounds = paddleComp.shape.getGlobalBounds();
 
@@ -172,10 +217,8 @@ namespace CoreSystems
         }
 
         //$ ----- Brick Logic + Cache ----- //
-        auto brickView = registry->view<Brick>();
-        for (auto brickEntity : brickView)
+        for (auto [brickEntity, brickComp, health, score, type] : bricks.each())
         {
-            auto& brickComp = registry->get<Brick>(brickEntity);
             sf::FloatRect brickBounds = brickComp.shape.getGlobalBounds();
 
             //$ Brick hitting bottom of window
@@ -198,26 +241,22 @@ namespace CoreSystems
             // If not game over, add brick bounds to vector cache
             if (!triggerGameOver)
             {
-                brickCache.push_back({ brickEntity, brickBounds });
+                brickCache.push_back({ brickEntity, brickBounds, type });
             }
         }
 
         //$ Check for game over after checking paddle/brick, brick/window collisions!
         if (triggerGameOver)
         {
-            auto gameoverState = std::make_unique<GameTransitionState>(context);
-            stateManager->replaceState(std::move(gameoverState));
+            deferTransition(context, commands, TransitionType::LevelLoss);
             logger::Info("Game Over triggered.");
             return;
         }
 
         //$ ----- Ball Collision Logic ----- //
-        auto ballView = registry->view<Ball, Velocity, MovementSpeed>();
-        for (auto ballEntity : ballView)
+        for (auto [ballEntity, ballComp, ballVelocity, ballSpeedComp] : ballGroup(registry).each())
         {
-            auto& ballComp = registry->get<Ball>(ballEntity);
-            auto& ballVelocity = registry->get<Velocity>(ballEntity);
-            float ballSpeed = registry->get<MovementSpeed>(ballEntity).value;
+            float ballSpeed = ballSpeedComp.value;
 
             sf::Vector2f ballPosition = ballComp.shape.getPosition(); // Center
             float ballRadius = ballComp.shape.getRadius();
@@ -226,21 +265,21 @@ namespace CoreSystems
             // West Wall
             if (ballPosition.x - ballRadius < 0.0f)
             {
-                playSound(context, Assets::SoundBuffers::WallHit);
+                deferSound(context, commands, Assets::SoundBuffers::WallHit);
                 ballPosition.x = ballRadius;
                 ballVelocity.value.x *= -1.0f;
             }
             // East Wall
             if (ballPosition.x + ballRadius > windowSize.x)
             {
-                playSound(context, Assets::SoundBuffers::WallHit);
+                deferSound(context, commands, Assets::SoundBuffers::WallHit);
                 ballPosition.x = windowSize.x - ballRadius;
                 ballVelocity.value.x *= -1.0f;
             }
             // North Wall
             if (ballPosition.y - ballRadius < 0.0f)
             {
-                playSound(context, Assets::SoundBuffers::WallHit);
+                deferSound(context, commands, Assets::SoundBuffers::WallHit);
                 ballPosition.y = ballRadius;
                 ballVelocity.value.y *= -1.0f;
             }
@@ -262,7 +301,7 @@ namespace CoreSystems
             {
                 if (ballBounds.findIntersection(paddleBounds))
                 {
-                    playSound(context, Assets::SoundBuffers::PaddleHit);
+                    deferSound(context, commands, Assets::SoundBuffers::PaddleHit);
 
                     // calculate offset (-1 to 1)
                     // (ball - center) / half of paddle width
@@ -282,21 +321,26 @@ namespace CoreSystems
             }
 
             //$ ----- Ball vs Bricks ----- //
-            //auto brickView = registry->view<Brick, BrickScore, BrickHealth, BrickType>();
             for (const auto& cachedBrick : brickCache)
             {
                 // safety check
-                if (!registry->valid(cachedBrick.entity))
+                if (!registry.valid(cachedBrick.entity))
                 {
                     continue;
                 }
 
                 if (auto intersection = ballBounds.findIntersection(cachedBrick.bounds))
                 {
-                    playSound(context, Assets::SoundBuffers::BrickHit);
+                    deferSound(context, commands, Assets::SoundBuffers::BrickHit);
 
-                    auto& brickShape = registry->get<Brick>(cachedBrick.entity);
-                    auto brickType = registry->get<BrickType>(cachedBrick.entity);
+                    auto [brickShape, brickHealthComp, brickScoreValue] =
+                        bricks.get<Brick, BrickHealth, BrickScore>(cachedBrick.entity);
+                    // already broken this frame, just waiting for the command buffer
+                    if (brickHealthComp.current <= 0)
+                    {
+                        continue;
+                    }
+                    auto brickType = cachedBrick.type;
 
                     // Check if hit top or bottom
                     if (intersection->size.x > intersection->size.y)
@@ -338,7 +382,7 @@ namespace CoreSystems
 
                     // Handle brick health
                     bool destroyed = false;
-                    auto& brickHealth = registry->get<BrickHealth>(cachedBrick.entity).current;
+                    auto& brickHealth = brickHealthComp.current;
                     brickHealth -= 1;
                     if (brickHealth <= 0)
                     {
@@ -350,24 +394,23 @@ namespace CoreSystems
                         // play appropriate brick destruction sound
                         if (brickType == BrickType::Normal)
                         {
-                            playSound(context, Assets::SoundBuffers::NormBrickBreak);
+                            deferSound(context, commands, Assets::SoundBuffers::NormBrickBreak);
                         }
                         else if (brickType == BrickType::Strong)
                         {
-                            playSound(context, Assets::SoundBuffers::StrongBrickBreak);
+                            deferSound(context, commands, Assets::SoundBuffers::StrongBrickBreak);
                         }
                         else if (brickType == BrickType::Gold)
                         {
-                            playSound(context, Assets::SoundBuffers::GoldBrickBreak);
+                            deferSound(context, commands, Assets::SoundBuffers::GoldBrickBreak);
                         }
                         else
                         {
-                            playSound(context, Assets::SoundBuffers::NormBrickBreak);
+                            deferSound(context, commands, Assets::SoundBuffers::NormBrickBreak);
                         }
 
                         // handle scoring
-                        auto brickScoreValue = registry->get<BrickScore>(cachedBrick.entity);
-                        auto scoreView = registry->view<HUDTag, ScoreHUDTag, CurrentScore, UIText>();
+                        auto scoreView = registry.view<HUDTag, ScoreHUDTag, CurrentScore, UIText>();
                         for (auto scoreEntity : scoreView)
                         {
                             auto& scoreText = scoreView.get<UIText>(scoreEntity);
@@ -377,25 +420,20 @@ namespace CoreSystems
                         }
 
                         // remove the non-paddle rectangle we've collided with
-                        registry->destroy(cachedBrick.entity);
+                        commands.destroy(cachedBrick.entity);
+                        --bricksLeft;
 
-                        if (registry->view<Brick>().empty())
+                        if (bricksLeft == 0)
                         {
                             if (context.m_AppData.levelNumber >= context.m_AppData.totalLevels)
                             {
                                 logger::Info("Completed the last level.");
-
-                                auto gameState = std::make_unique<GameTransitionState>(context,
-                                                 TransitionType::GameWin);
-                                stateManager->replaceState(std::move(gameState));
+                                deferTransition(context, commands, TransitionType::GameWin);
                             }
                             else
                             {
                                 logger::Info("All bricks destroyed. Level complete!");
-
-                                auto winState = std::make_unique<GameTransitionState>(context,
-                                                 TransitionType::LevelWin);
-                                stateManager->replaceState(std::move(winState));
+                                deferTransition(context, commands, TransitionType::LevelWin);
                             }
 
                             return;
@@ -407,9 +445,7 @@ namespace CoreSystems
                     {
                         if (brickType == BrickType::Strong)
                         {
-                            brickShape.shape.setFillColor(utils::loadColorFromConfig(
-                                *context.m_ConfigManager, Assets::Configs::Bricks,
-                                "strongDamaged", "strongDamagedRGB"));
+                            brickShape.shape.setFillColor(context.m_Config.bricks.strongDamagedColor);
                         }
                     }
                 }
@@ -419,28 +455,27 @@ namespace CoreSystems
         // Check if game is over
         if (triggerGameOver)
         {
-            auto gameoverState = std::make_unique<GameTransitionState>(context);
-            stateManager->replaceState(std::move(gameoverState));
+            deferTransition(context, commands, TransitionType::LevelLoss);
             logger::Info("Game Over triggered.");
         }
     }
 
-    void renderSystem(entt::registry& registry, sf::RenderWindow& window, bool showDebug)
+    void renderSystem(entt::registry& registry, RenderSnapshot& snapshot, bool showDebug)
     {
         // Draw all Rectangles
         auto rectView = registry.view<Paddle>();
         for (auto entity : rectView)
         {
             auto& rectComp = rectView.get<Paddle>(entity);
-            window.draw(rectComp.shape);
+            snapshot.draw(rectComp.shape);
         }
 
-        // Draw all Bricks
+        // Draw all Bricks (batched into one vertex array)
         auto brickView = registry.view<Brick>();
         for (auto entity : brickView)
         {
             auto& brickComp = brickView.get<Brick>(entity);
-            window.draw(brickComp.shape);
+            snapshot.drawBatched(brickComp.shape);
         }
 
         // Draw all Circles
@@ -448,7 +483,7 @@ namespace CoreSystems
         for (auto entity : circleView)
         {
             auto& circleComp = circleView.get<Ball>(entity);
-            window.draw(circleComp.shape);
+            snapshot.draw(circleComp.shape);
         }
     }
 
@@ -480,59 +515,75 @@ namespace CoreSystems
 
     void moveBricksDown(entt::registry& registry, float amount)
     {
-        auto brickView = registry.view<Brick>();
-        for (auto bricks : brickView)
+        for (auto [brickEntity, brick, health, score, type] : brickGroup(registry).each())
         {
-            auto& brick = brickView.get<Brick>(bricks);
             brick.shape.move({ 0.0f, amount });
         }
     }
+
+    void applyConfigReload(AppContext& context, entt::registry& registry, std::string_view configID)
+    {
+        const GameConfig& config = context.m_Config;
+
+        if (configID == Assets::Configs::Player)
+        {
+            auto view = registry.view<PaddleTag, Paddle, MovementSpeed>();
+            for (auto [paddleEntity, paddle, speed] : view.each())
+            {
+                speed.value = config.player.movementSpeed;
+                paddle.shape.setSize({ config.player.paddleWidth, config.player.paddleHeight });
+                paddle.shape.setFillColor(config.player.paddleColor);
+                utils::centerOrigin(paddle.shape);
+            }
+        }
+        else if (configID == Assets::Configs::Ball)
+        {
+            for (auto [ballEntity, ball, velocity, speed] : ballGroup(registry).each())
+            {
+                // keep the direction, change the speed
+                if (speed.value > 0.0f)
+                {
+                    velocity.value *= config.ball.speed / speed.value;
+                }
+                speed.value = config.ball.speed;
+
+                ball.shape.setRadius(config.ball.radius);
+                ball.shape.setOrigin({ config.ball.radius, config.ball.radius });
+                ball.shape.setFillColor(config.ball.color);
+            }
+        }
+        else if (configID == Assets::Configs::Bricks)
+        {
+            for (auto [brickEntity, brick, health, score, type] : brickGroup(registry).each())
+            {
+                const BrickArchetype& archetype = config.bricks.get(type);
+                score.value = archetype.scoreValue;
+
+                bool damaged = (type == BrickType::Strong && health.current < health.max);
+                brick.shape.setFillColor(damaged ? config.bricks.strongDamagedColor
+                                                 : archetype.color);
+            }
+        }
+    }
 }
 
 namespace UISystems
 {
     //$ --- UI Systems Implementation ---
-    void uiRenderSystem(entt::registry& registry, sf::RenderWindow& window)
+    void uiRenderSystem(entt::registry& registry, RenderSnapshot& snapshot)
     {
-        // Render shapes
+        // Render shapes (hover colors are applied when UIHover changes, see connectUIHover)
         auto shapeView = registry.view<UIShape>();
         for (auto shapeEntity : shapeView)
         {
-            auto& uiShape = shapeView.get<UIShape>(shapeEntity);
-
-            // Change color on hover
-            if (registry.all_of<UIHover>(shapeEntity))
-            {
-                uiShape.shape.setFillColor(sf::Color(100, 100, 255)); // Hover color
-            }
-            else
-            {
-                uiShape.shape.setFillColor(sf::Color::Blue); // Normal color
-            }
-
-            window.draw(uiShape.shape);
+            snapshot.draw(shapeView.get<UIShape>(shapeEntity).shape);
         }
 
         // Render text
         auto textView = registry.view<UIText>();
         for (auto textEntity : textView)
         {
-            auto& uiText = textView.get<UIText>(textEntity);
-
-            // Change text color on hover for interactive UI
-            if (registry.any_of<UIAction, UIBounds>(textEntity))
-            {
-                if (registry.all_of<UIHover>(textEntity))
-                {
-                    uiText.text.setFillColor(sf::Color::White); // Hover text color
-                }
-                else
-                {
-                    uiText.text.setFillColor(sf::Color(200, 200, 200)); // Normal text color
-                }
-            }
-
-            window.draw(uiText.text);
+            snapshot.draw(textView.get<UIText>(textEntity).text);
         }
 
         // Render UI buttons
@@ -540,7 +591,7 @@ namespace UISystems
         for (auto buttonEntity : buttonView)
         {
             auto& button = buttonView.get<GUISprite>(buttonEntity);
-            window.draw(button.sprite);
+            snapshot.draw(button.sprite);
         }
 
         // Render Red X overlay
@@ -548,7 +599,7 @@ namespace UISystems
         for (auto entity : xView)
         {
             auto& redX = xView.get<GUIRedX>(entity);
-            window.draw(redX.sprite);
+            snapshot.draw(redX.sprite);
         }
     }
 
@@ -572,60 +623,121 @@ namespace UISystems
         }
     }
 
-    void uiHoverSystem(entt::registry& registry, sf::RenderWindow& window)
+    void uiHoverSystem(entt::registry& registry, sf::Vector2f mousePosition)
     {
-        sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-        auto view = registry.view<UIBounds>();
+        auto* index = registry.ctx().find<UIHoverIndex>();
+        if (!index)
+        {
+            return;
+        }
+        if (index->isDirty())
+        {
+            index->rebuild(registry);
+        }
 
-        for (auto entity : view)
+        // Everything under the mouse right now (usually 0 or 1 entities)
+        std::array<entt::entity, 8> underMouse{};
+        std::size_t count = 0;
+        for (auto entity : index->candidatesAt(mousePosition))
         {
-            const auto& bounds = view.get<UIBounds>(entity);
-            if (bounds.rect.contains(mousePos))
+            if (count < underMouse.size() && registry.get<UIBounds>(entity).rect.contains(mousePosition))
             {
-                registry.emplace_or_replace<UIHover>(entity);
+                underMouse[count++] = entity;
             }
-            else if (registry.all_of<UIHover>(entity))
+        }
+        std::span<const entt::entity> current(underMouse.data(), count);
+
+        // Leave
+        auto& hovered = index->hovered();
+        for (auto entity : hovered)
+        {
+            if (std::ranges::find(current, entity) == current.end()
+                && registry.valid(entity) && registry.all_of<UIHover>(entity))
             {
                 registry.remove<UIHover>(entity);
             }
         }
+
+        // Enter
+        for (auto entity : current)
+        {
+            if (!registry.all_of<UIHover>(entity))
+            {
+                registry.emplace<UIHover>(entity);
+            }
+        }
+
+        hovered.assign(current.begin(), current.end());
+    }
+
+    void applyHoverStyle(entt::registry& registry, entt::entity entity, bool hovered)
+    {
+        if (auto* uiShape = registry.try_get<UIShape>(entity))
+        {
+            uiShape->shape.setFillColor(hovered ? sf::Color(100, 100, 255) : sf::Color::Blue);
+        }
+
+        auto* uiText = registry.try_get<UIText>(entity);
+        if (uiText && registry.any_of<UIAction, UIBounds>(entity))
+        {
+            uiText->text.setFillColor(hovered ? sf::Color::White : sf::Color(200, 200, 200));
+        }
     }
 
-    void uiSettingsChecks(AppContext& context)
+    void connectUIHover(entt::registry& registry, std::pmr::memory_resource* resource)
     {
+        registry.ctx().emplace<UIHoverIndex>(resource);
+
+        // UIBounds added / replaced / removed -> rebuild on the next hover update
+        registry.on_construct<UIBounds>().connect<&markHoverIndexDirty>();
+        registry.on_update<UIBounds>().connect<&markHoverIndexDirty>();
+        registry.on_destroy<UIBounds>().connect<&markHoverIndexDirty>();
+
+        registry.on_construct<UIHover>().connect<&onHoverEnter>();
+        registry.on_destroy<UIHover>().connect<&onHoverLeave>();
+    }
+
+    void uiSettingsChecks(AppContext& context, entt::registry& registry)
+    {
+        auto buttonView = registry.view<UIDirty, GUISprite, UIToggleCond>();
+        if (buttonView.begin() == buttonView.end())
+        {
+            return;
+        }
+
         auto* buttonRedX = context.m_ResourceManager->getResource<sf::Texture>(
                                                                 Assets::Textures::ButtonRedX);
         if (!buttonRedX)
         {
+            registry.clear<UIDirty>();
             return;
         }
 
         auto redXSprite = sf::Sprite(*buttonRedX);
         utils::centerOrigin(redXSprite);
 
-        auto& registry = context.m_Registry;
-        
-        auto buttonView = registry->view<GUISprite, UIToggleCond>();
         for (auto buttonEntity : buttonView)
         {
             auto& condition = buttonView.get<UIToggleCond>(buttonEntity);
             if (condition.shouldShowOverlay())
             {
-                if (!registry->all_of<GUIRedX>(buttonEntity))
+                if (!registry.all_of<GUIRedX>(buttonEntity))
                 {
-                    auto& buttonSprite = registry->get<GUISprite>(buttonEntity);
+                    auto& buttonSprite = registry.get<GUISprite>(buttonEntity);
                     auto buttonCenter = buttonSprite.sprite.getGlobalBounds().getCenter();
                     redXSprite.setPosition(buttonCenter);
-                    registry->emplace<GUIRedX>(buttonEntity, redXSprite);
+                    registry.emplace<GUIRedX>(buttonEntity, redXSprite);
                 }
             }
             else 
             {
-                if (registry->all_of<GUIRedX>(buttonEntity))
+                if (registry.all_of<GUIRedX>(buttonEntity))
                 {
-                    registry->remove<GUIRedX>(buttonEntity);
+                    registry.remove<GUIRedX>(buttonEntity);
                 }
             }
         }
+
+        registry.clear<UIDirty>();
     }
 }
@@ -0,0 +1,84 @@
+#include <SFML/Graphics.hpp>
+#include <entt/entt.hpp>
+
+#include "ECS/UIHoverIndex.hpp"
+#include "ECS/Components.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+UIHoverIndex::UIHoverIndex(std::pmr::memory_resource* resource)
+    : m_Cells(resource)
+    , m_Hovered(resource)
+{
+}
+
+void UIHoverIndex::rebuild(const entt::registry& registry)
+{
+    m_Dirty = false;
+    m_Cells.clear();
+    m_Columns = 0;
+    m_Rows = 0;
+
+    auto view = registry.view<UIBounds>();
+    if (view.empty())
+    {
+        return;
+    }
+
+    // Grid covers the union of all bounds
+    sf::Vector2f min{ std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+    sf::Vector2f max{ std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+    for (auto [entity, bounds] : view.each())
+    {
+        min.x = std::min(min.x, bounds.rect.position.x);
+        min.y = std::min(min.y, bounds.rect.position.y);
+        max.x = std::max(max.x, bounds.rect.position.x + bounds.rect.size.x);
+        max.y = std::max(max.y, bounds.rect.position.y + bounds.rect.size.y);
+    }
+
+    m_Origin = min;
+    m_Columns = static_cast<std::size_t>(std::floor((max.x - min.x) / CellSize)) + 1;
+    m_Rows = static_cast<std::size_t>(std::floor((max.y - min.y) / CellSize)) + 1;
+    m_Cells.resize(m_Columns * m_Rows);
+
+    for (auto [entity, bounds] : view.each())
+    {
+        sf::Vector2f topLeft = bounds.rect.position - m_Origin;
+        sf::Vector2f bottomRight = topLeft + bounds.rect.size;
+
+        std::size_t firstColumn = static_cast<std::size_t>(topLeft.x / CellSize);
+        std::size_t firstRow = static_cast<std::size_t>(topLeft.y / CellSize);
+        std::size_t lastColumn = std::min(static_cast<std::size_t>(bottomRight.x / CellSize), m_Columns - 1);
+        std::size_t lastRow = std::min(static_cast<std::size_t>(bottomRight.y / CellSize), m_Rows - 1);
+
+        for (std::size_t row = firstRow; row <= lastRow; ++row)
+        {
+            for (std::size_t column = firstColumn; column <= lastColumn; ++column)
+            {
+                m_Cells[row * m_Columns + column].push_back(entity);
+            }
+        }
+    }
+}
+
+std::span<const entt::entity> UIHoverIndex::candidatesAt(sf::Vector2f point) const
+{
+    sf::Vector2f local = point - m_Origin;
+    if (m_Cells.empty() || local.x < 0.0f || local.y < 0.0f)
+    {
+        return {};
+    }
+
+    std::size_t column = static_cast<std::size_t>(local.x / CellSize);
+    std::size_t row = static_cast<std::size_t>(local.y / CellSize);
+    if (column >= m_Columns || row >= m_Rows)
+    {
+        return {};
+    }
+
+    return m_Cells[row * m_Columns + column];
+}
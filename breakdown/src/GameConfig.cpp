@@ -0,0 +1,56 @@
+#include <toml++/toml.hpp>
+
+#include "GameConfig.hpp"
+#include "Managers/ConfigBinding.hpp"
+#include "Managers/ConfigManager.hpp"
+#include "AssetKeys.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <array>
+#include <cstddef>
+#include <format>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // Section names in Bricks.toml, indexed by BrickType
+    constexpr std::array<std::string_view, BrickTypeCount> BrickSections = {
+        "normal", "strong", "gold", "custom_1", "custom_2"
+    };
+
+    template<typename Struct>
+    void bindFile(const ConfigManager& configManager, std::string_view configID, Struct& out,
+                  std::string_view section = {})
+    {
+        const toml::table* table = configManager.getConfigTable(configID);
+        if (!table)
+        {
+            logger::Error(std::format("Config [{}] isn't loaded; using defaults.", configID));
+            return;
+        }
+
+        ConfigBinding::bind<Struct>(*table, configID, Struct::Fields, out, section);
+    }
+}
+
+void GameConfig::bindWindow(const ConfigManager& configManager)
+{
+    bindFile(configManager, Assets::Configs::Window, window);
+}
+
+void GameConfig::bindGameplay(const ConfigManager& configManager)
+{
+    bindFile(configManager, Assets::Configs::Player, player);
+    bindFile(configManager, Assets::Configs::Ball, ball);
+
+    for (std::size_t i = 0; i < BrickTypeCount; ++i)
+    {
+        bindFile(configManager, Assets::Configs::Bricks, bricks.archetypes[i], BrickSections[i]);
+    }
+
+    bindFile(configManager, Assets::Configs::Bricks, bricks);
+
+    logger::Info("Gameplay configs bound.");
+}
@@ -0,0 +1,343 @@
+#include <toml++/toml.hpp>
+
+#include "Managers/ConfigCache.hpp"
+#include "Utilities/BinaryIO.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint32_t CacheMagic = 0x46434442; // "BDCF"
+    constexpr std::uint32_t CacheVersion = 1;
+    // corrupt data shouldn't be able to recurse forever
+    constexpr int MaxDepth = 64;
+
+    enum class NodeTag : std::uint8_t
+    {
+        Table,
+        Array,
+        String,
+        Integer,
+        Float,
+        Boolean
+    };
+
+    //$ ----- Encoding ----- //
+    bool encodeTable(utils::BinaryWriter& writer, const toml::table& table);
+    bool encodeArray(utils::BinaryWriter& writer, const toml::array& array);
+
+    bool encodeNode(utils::BinaryWriter& writer, const toml::node& node)
+    {
+        switch (node.type())
+        {
+            case toml::node_type::table:
+                writer.write(NodeTag::Table);
+                return encodeTable(writer, *node.as_table());
+            case toml::node_type::array:
+                writer.write(NodeTag::Array);
+                return encodeArray(writer, *node.as_array());
+            case toml::node_type::string:
+                writer.write(NodeTag::String);
+                writer.writeString(node.as_string()->get());
+                return true;
+            case toml::node_type::integer:
+                writer.write(NodeTag::Integer);
+                writer.write(node.as_integer()->get());
+                return true;
+            case toml::node_type::floating_point:
+                writer.write(NodeTag::Float);
+                writer.write(node.as_floating_point()->get());
+                return true;
+            case toml::node_type::boolean:
+                writer.write(NodeTag::Boolean);
+                writer.write(static_cast<std::uint8_t>(node.as_boolean()->get()));
+                return true;
+            default:
+                // dates/times: none of our configs use them, such files just aren't cached
+                return false;
+        }
+    }
+
+    bool encodeTable(utils::BinaryWriter& writer, const toml::table& table)
+    {
+        writer.write(static_cast<std::uint32_t>(table.size()));
+        for (auto&& [key, node] : table)
+        {
+            writer.writeString(key.str());
+            if (!encodeNode(writer, node))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool encodeArray(utils::BinaryWriter& writer, const toml::array& array)
+    {
+        writer.write(static_cast<std::uint32_t>(array.size()));
+        for (const auto& node : array)
+        {
+            if (!encodeNode(writer, node))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //$ ----- Decoding ----- //
+    bool decodeTable(utils::BinaryReader& reader, toml::table& table, int depth);
+    bool decodeArray(utils::BinaryReader& reader, toml::array& array, int depth);
+
+    // Decodes one node and hands the value to insert()
+    template<typename Insert>
+    bool decodeNode(utils::BinaryReader& reader, Insert&& insert, int depth)
+    {
+        if (depth > MaxDepth)
+        {
+            return false;
+        }
+
+        switch (reader.read<NodeTag>())
+        {
+            case NodeTag::Table:
+            {
+                toml::table table;
+                if (!decodeTable(reader, table, depth + 1))
+                {
+                    return false;
+                }
+                insert(std::move(table));
+                break;
+            }
+            case NodeTag::Array:
+            {
+                toml::array array;
+                if (!decodeArray(reader, array, depth + 1))
+                {
+                    return false;
+                }
+                insert(std::move(array));
+                break;
+            }
+            case NodeTag::String:
+                insert(std::string(reader.readString()));
+                break;
+            case NodeTag::Integer:
+                insert(reader.read<std::int64_t>());
+                break;
+            case NodeTag::Float:
+                insert(reader.read<double>());
+                break;
+            case NodeTag::Boolean:
+                insert(reader.read<std::uint8_t>() != 0);
+                break;
+            default:
+                return false;
+        }
+        return !reader.failed();
+    }
+
+    bool decodeTable(utils::BinaryReader& reader, toml::table& table, int depth)
+    {
+        auto count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < count && !reader.failed(); ++i)
+        {
+            std::string_view key = reader.readString();
+            bool decoded = decodeNode(reader, [&](auto&& value) {
+                table.insert_or_assign(key, std::forward<decltype(value)>(value));
+            }, depth);
+
+            if (!decoded)
+            {
+                return false;
+            }
+        }
+        return !reader.failed();
+    }
+
+    bool decodeArray(utils::BinaryReader& reader, toml::array& array, int depth)
+    {
+        auto count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < count && !reader.failed(); ++i)
+        {
+            bool decoded = decodeNode(reader, [&](auto&& value) {
+                array.push_back(std::forward<decltype(value)>(value));
+            }, depth);
+
+            if (!decoded)
+            {
+                return false;
+            }
+        }
+        return !reader.failed();
+    }
+}
+
+bool ConfigCache::open(std::string_view cachePath)
+{
+    m_Path = cachePath;
+    m_Entries.clear();
+    m_Dirty = false;
+
+    if (!m_File.open(cachePath))
+    {
+        logger::Info(std::format("No config cache at {}; it will be built.", cachePath));
+        return false;
+    }
+
+    utils::BinaryReader reader(m_File.data());
+    bool validHeader = reader.read<std::uint32_t>() == CacheMagic
+                    && reader.read<std::uint32_t>() == CacheVersion;
+    auto count = reader.read<std::uint32_t>();
+
+    std::map<std::string, Entry, std::less<>> entries;
+    for (std::uint32_t i = 0; validHeader && i < count && !reader.failed(); ++i)
+    {
+        std::string sourcePath(reader.readString());
+        Entry entry;
+        entry.stamp.mtime = reader.read<std::int64_t>();
+        entry.stamp.size = reader.read<std::uint64_t>();
+        entry.stamp.hash = reader.read<std::uint64_t>();
+        entry.data = reader.readBytes(reader.read<std::uint64_t>());
+        entries.insert_or_assign(std::move(sourcePath), std::move(entry));
+    }
+
+    if (!validHeader || reader.failed())
+    {
+        logger::Warn(std::format("Config cache {} is invalid; it will be rebuilt.", cachePath));
+        m_File.close();
+        return false;
+    }
+
+    m_Entries = std::move(entries);
+    logger::Info(std::format("Config cache mapped: {} entries.", m_Entries.size()));
+    return true;
+}
+
+std::optional<toml::table> ConfigCache::load(std::string_view sourcePath)
+{
+    auto it = m_Entries.find(sourcePath);
+    if (it == m_Entries.end())
+    {
+        return std::nullopt;
+    }
+
+    Entry& entry = it->second;
+    if (!utils::fileMatches(sourcePath, entry.stamp))
+    {
+        return std::nullopt;
+    }
+
+    // touched (checkout, copy...) but not edited: restamp so next launch skips the hash
+    std::optional<utils::FileStamp> current = utils::statFile(sourcePath);
+    if (current && current->mtime != entry.stamp.mtime)
+    {
+        entry.stamp.mtime = current->mtime;
+        m_Dirty = true;
+    }
+
+    toml::table table;
+    utils::BinaryReader reader(entry.data);
+    if (!decodeTable(reader, table, 0) || !reader.atEnd())
+    {
+        logger::Warn(std::format("Cached config for {} is corrupt; re-parsing.", sourcePath));
+        return std::nullopt;
+    }
+    return table;
+}
+
+void ConfigCache::store(std::string_view sourcePath, const toml::table& table)
+{
+    std::optional<utils::FileStamp> stamp = utils::statFile(sourcePath);
+    std::optional<std::uint64_t> hash = utils::hashFile(sourcePath);
+    if (!stamp || !hash)
+    {
+        return;
+    }
+    stamp->hash = *hash;
+
+    utils::BinaryWriter writer;
+    if (!encodeTable(writer, table))
+    {
+        logger::Info(std::format("{} has values the config cache can't hold; not cached.", sourcePath));
+        m_Dirty |= (m_Entries.erase(sourcePath) > 0);
+        return;
+    }
+
+    Entry entry;
+    entry.stamp = *stamp;
+    entry.owned = writer.release();
+    entry.data = entry.owned;
+    m_Entries.insert_or_assign(std::string(sourcePath), std::move(entry));
+    m_Dirty = true;
+}
+
+bool ConfigCache::save()
+{
+    if (!m_Dirty || m_Path.empty())
+    {
+        return true;
+    }
+
+    utils::BinaryWriter writer;
+    writer.write(CacheMagic);
+    writer.write(CacheVersion);
+    writer.write(static_cast<std::uint32_t>(m_Entries.size()));
+    for (const auto& [sourcePath, entry] : m_Entries)
+    {
+        writer.writeString(sourcePath);
+        writer.write(entry.stamp.mtime);
+        writer.write(entry.stamp.size);
+        writer.write(entry.stamp.hash);
+        writer.write(static_cast<std::uint64_t>(entry.data.size()));
+        writer.writeBytes(entry.data);
+    }
+
+    // Entries may point into the mapping we're about to replace: keep them in memory
+    for (auto& [sourcePath, entry] : m_Entries)
+    {
+        if (entry.owned.empty())
+        {
+            entry.owned.assign(entry.data.begin(), entry.data.end());
+            entry.data = entry.owned;
+        }
+    }
+    m_File.close();
+
+    // Write next to it and swap, so a crash mid-write can't leave a torn cache
+    std::string tempPath = m_Path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        const auto& bytes = writer.buffer();
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+            logger::Warn(std::format("Couldn't write config cache {}.", tempPath));
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, m_Path, error);
+    if (error)
+    {
+        logger::Warn(std::format("Couldn't replace config cache {}: {}", m_Path, error.message()));
+        return false;
+    }
+
+    m_Dirty = false;
+    logger::Info(std::format("Config cache saved: {} entries.", m_Entries.size()));
+    return true;
+}
@@ -4,9 +4,22 @@
 #include "Utilities/Logger.hpp"
 
 #include <format>
+#include <optional>
 #include <string_view>
 #include <string>
 #include <vector>
+#include <memory_resource>
+#include <utility>
+
+void ConfigManager::openCache(std::string_view cachePath)
+{
+    m_Cache.open(cachePath);
+}
+
+void ConfigManager::saveCache()
+{
+    m_Cache.save();
+}
 
 void ConfigManager::loadConfig(std::string_view configID, std::string_view filepath)
 {
@@ -18,6 +31,15 @@ void ConfigManager::loadConfig(std::string_view configID, std::string_view filep
         return;
     }
 
+    m_ConfigPaths.insert_or_assign(std::string(configID), std::string(filepath));
+
+    if (auto cached = m_Cache.load(filepath))
+    {
+        m_ConfigFiles.insert_or_assign(std::string(configID), std::move(*cached));
+        logger::Info(std::format("Config ID \"{}\" loaded from cache ({})", configID, filepath));
+        return;
+    }
+
     toml::parse_result configFile = toml::parse_file(filepath);
 
     if (!configFile)
@@ -28,11 +50,45 @@ void ConfigManager::loadConfig(std::string_view configID, std::string_view filep
         return;
     }
 
+    m_Cache.store(filepath, configFile.table());
     m_ConfigFiles.insert_or_assign(std::string(configID), std::move(configFile.table()));
 
     logger::Info(std::format("Config ID \"{}\" loaded from: {}", configID, filepath));
 }
 
+std::optional<toml::table> ConfigManager::parseFile(std::string_view filepath)
+{
+    toml::parse_result configFile = toml::parse_file(filepath);
+    if (!configFile)
+    {
+        logger::Error(std::format(
+            "Error parsing config file {} --> {}", filepath, configFile.error().description()
+        ));
+        return std::nullopt;
+    }
+    return std::move(configFile.table());
+}
+
+void ConfigManager::replaceConfig(std::string_view configID, std::string_view filepath, toml::table table)
+{
+    m_ConfigPaths.insert_or_assign(std::string(configID), std::string(filepath));
+    m_Cache.store(filepath, table);
+    m_ConfigFiles.insert_or_assign(std::string(configID), std::move(table));
+    logger::Info(std::format("Config ID \"{}\" reloaded from: {}", configID, filepath));
+}
+
+std::optional<std::string> ConfigManager::findConfigID(std::string_view filepath) const
+{
+    for (const auto& [configID, path] : m_ConfigPaths)
+    {
+        if (path == filepath)
+        {
+            return configID;
+        }
+    }
+    return std::nullopt;
+}
+
 const toml::table* ConfigManager::getConfigTable(std::string_view configID) const
 {
     auto it = m_ConfigFiles.find(configID);
@@ -45,11 +101,11 @@ const toml::table* ConfigManager::getConfigTable(std::string_view configID) cons
     return &it->second;
 }
 
-std::vector<std::string> ConfigManager::getStringArray(
-    std::string_view configID, std::string_view section, std::string_view key, 
-    const std::source_location& loc) const
+std::pmr::vector<std::pmr::string> ConfigManager::getStringArray(
+    std::string_view configID, std::string_view section, std::string_view key,
+    std::pmr::memory_resource* resource, const std::source_location& loc) const
 {
-    std::vector<std::string> result;
+    std::pmr::vector<std::pmr::string> result(resource);
 
     auto it = m_ConfigFiles.find(configID);
     if (it == m_ConfigFiles.end())
@@ -83,11 +139,12 @@ std::vector<std::string> ConfigManager::getStringArray(
     }
 
     const auto& arr = *node.as_array();
+    result.reserve(arr.size());
     for (const auto& elem : arr)
     {
-        if (auto str = elem.value<std::string>())
+        if (auto str = elem.value<std::string_view>())
         {
-            result.push_back(*str);
+            result.emplace_back(*str);
         }
         else
         {
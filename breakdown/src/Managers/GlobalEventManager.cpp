@@ -13,19 +13,20 @@ GlobalEventManager::GlobalEventManager(AppContext* context)
 		throw std::invalid_argument("GlobalEventManager requires a non-null context");
     }
     
-    m_Events.onClose = [context](const sf::Event::Closed&)
-	{
-		context->m_MainWindow->close();
-	};
+    m_Bus.subscribe<sf::Event::Closed>([context](const sf::Event::Closed&) {
+		context->m_Renderer->closeWindow();
+		return EventResult::Consumed;
+	}, EventPriority::Global);
 
-	m_Events.onGlobalKeyPress = [context](const sf::Event::KeyPressed& event)
-	{
-		if (event.scancode == sf::Keyboard::Scancode::Escape)
+	// Consumed, so no state handles Escape as well
+	m_Bus.subscribe<sf::Event::KeyPressed>([context](const sf::Event::KeyPressed& event) {
+		if (event.scancode != sf::Keyboard::Scancode::Escape)
 		{
-			// We will want to remove this if we want escape to exit an inventory window etc.
-			logger::Info("Escape key pressed! Exiting.");
-			context->m_MainWindow->close();
+			return EventResult::Pass;
 		}
-	};
-	
+		// We will want to remove this if we want escape to exit an inventory window etc.
+		logger::Info("Escape key pressed! Exiting.");
+		context->m_Renderer->closeWindow();
+		return EventResult::Consumed;
+	}, EventPriority::Global);
 }
\ No newline at end of file
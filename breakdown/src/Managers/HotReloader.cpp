@@ -0,0 +1,94 @@
+#include <toml++/toml.hpp>
+
+#include "Managers/HotReloader.hpp"
+#include "Managers/StateManager.hpp"
+#include "AppContext.hpp"
+#include "AssetKeys.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+HotReloader::HotReloader(AppContext& context)
+    : m_AppContext(context)
+{
+}
+
+void HotReloader::watch(std::string_view filepath)
+{
+    m_Watcher.watch(filepath);
+}
+
+bool HotReloader::start()
+{
+    return m_Watcher.start();
+}
+
+void HotReloader::poll()
+{
+    // Parse changed files off the main thread
+    for (std::string& filepath : m_Watcher.takeChanged())
+    {
+        auto result = std::make_shared<std::optional<toml::table>>();
+        utils::JobHandle job = m_AppContext.m_JobSystem->schedule([filepath, result]() {
+            *result = ConfigManager::parseFile(filepath);
+        });
+        m_Pending.push_back({ std::move(filepath), std::move(job), std::move(result) });
+    }
+
+    // A state being prepared on a worker (or a cancelled one still finishing) reads m_Config
+    if (m_AppContext.m_StateManager->isPreparing())
+    {
+        return;
+    }
+
+    // Apply the ones that are done, in the order they changed
+    auto firstPending = std::ranges::find_if(m_Pending,
+        [](const PendingParse& parse) { return !parse.job.isDone(); });
+
+    for (auto it = m_Pending.begin(); it != firstPending; ++it)
+    {
+        // a half-written file fails to parse; the next write reports it again
+        if (*it->result)
+        {
+            apply(it->filepath, std::move(**it->result));
+        }
+    }
+    m_Pending.erase(m_Pending.begin(), firstPending);
+}
+
+void HotReloader::apply(const std::string& filepath, toml::table table)
+{
+    auto& configManager = *m_AppContext.m_ConfigManager;
+    std::string configID;
+
+    if (filepath == m_AppContext.m_LevelPack->sourcePath())
+    {
+        configID = Assets::Configs::Levels;
+        configManager.replaceConfig(configID, filepath, std::move(table));
+        m_AppContext.m_LevelPack->rebuild(configManager, *m_AppContext.m_JobSystem);
+        m_AppContext.m_AppData.totalLevels = std::max(m_AppContext.m_LevelPack->levelCount(), 1);
+    }
+    else if (std::optional<std::string> loadedID = configManager.findConfigID(filepath))
+    {
+        configID = std::move(*loadedID);
+        configManager.replaceConfig(configID, filepath, std::move(table));
+        m_AppContext.m_Config.bindGameplay(configManager);
+    }
+    else
+    {
+        return;
+    }
+
+    // Snapshots were staged from the old values
+    m_AppContext.m_LevelSnapshots.clear();
+    configManager.saveCache();
+
+    m_AppContext.m_StateManager->onConfigReloaded(configID);
+    logger::Info(std::format("Hot reloaded {}.", filepath));
+}
@@ -0,0 +1,142 @@
+#include <SFML/Window/Keyboard.hpp>
+
+#include "Managers/InputBuffer.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+
+bool InputBuffer::isTracked(sf::Keyboard::Scancode key) noexcept
+{
+    auto index = static_cast<int>(key);
+    return index >= 0 && static_cast<std::size_t>(index) < KeyCount;
+}
+
+void InputBuffer::record(sf::Keyboard::Scancode key, bool pressed, Clock::time_point time)
+{
+    if (!isTracked(key))
+    {
+        return;
+    }
+
+    // Nothing is stepping (menus, pause...): don't let the events pile up
+    if (!m_Events.empty() && m_Events.front().time < time - PendingHorizon)
+    {
+        collapseBefore(time - PendingHorizon);
+    }
+    m_Events.push_back({ key, pressed, time });
+}
+
+void InputBuffer::releaseAll(Clock::time_point time)
+{
+    // What will be held once the pending events are applied
+    std::bitset<KeyCount> held = m_Held;
+    for (const KeyEvent& event : m_Events)
+    {
+        held[static_cast<std::size_t>(event.key)] = event.pressed;
+    }
+
+    for (std::size_t i = 0; i < KeyCount; ++i)
+    {
+        if (held[i])
+        {
+            m_Events.push_back({ static_cast<sf::Keyboard::Scancode>(i), false, time });
+        }
+    }
+}
+
+void InputBuffer::beginStep(Clock::time_point start, Clock::time_point end)
+{
+    using Seconds = std::chrono::duration<float>;
+    const float stepLength = std::max(Seconds(end - start).count(), 1e-6f);
+
+    m_PressedThisStep.reset();
+    m_HeldFraction.fill(0.0f);
+    m_StepEvents.clear();
+
+    auto consumedEnd = std::ranges::find_if(m_Events,
+        [end](const KeyEvent& event) { return event.time >= end; });
+
+    for (auto it = m_Events.begin(); it != consumedEnd; ++it)
+    {
+        auto index = static_cast<std::size_t>(it->key);
+        Clock::time_point time = std::max(it->time, start);
+        if (it->time >= start)
+        {
+            m_StepEvents.push_back(*it);
+        }
+
+        if (it->pressed)
+        {
+            // key repeat sends more presses while held; only the first one counts
+            if (m_Held[index])
+            {
+                continue;
+            }
+            m_Held[index] = true;
+            m_HeldSince[index] = time;
+            if (it->time >= start)
+            {
+                m_PressedThisStep[index] = true;
+            }
+        }
+        else if (m_Held[index])
+        {
+            m_Held[index] = false;
+            Clock::time_point since = std::max(m_HeldSince[index], start);
+            m_HeldFraction[index] += Seconds(time - since).count() / stepLength;
+        }
+    }
+    m_Events.erase(m_Events.begin(), consumedEnd);
+
+    // Still down at the end of the step
+    for (std::size_t i = 0; i < KeyCount; ++i)
+    {
+        if (m_Held[i])
+        {
+            Clock::time_point since = std::max(m_HeldSince[i], start);
+            m_HeldFraction[i] += Seconds(end - since).count() / stepLength;
+        }
+    }
+}
+
+void InputBuffer::collapseBefore(Clock::time_point time)
+{
+    auto collapsedEnd = std::ranges::find_if(m_Events,
+        [time](const KeyEvent& event) { return event.time >= time; });
+
+    for (auto it = m_Events.begin(); it != collapsedEnd; ++it)
+    {
+        auto index = static_cast<std::size_t>(it->key);
+        if (it->pressed && !m_Held[index])
+        {
+            m_Held[index] = true;
+            m_HeldSince[index] = it->time;
+        }
+        else if (!it->pressed)
+        {
+            m_Held[index] = false;
+        }
+    }
+    m_Events.erase(m_Events.begin(), collapsedEnd);
+}
+
+bool InputBuffer::isHeld(sf::Keyboard::Scancode key) const noexcept
+{
+    return isTracked(key) && m_Held[static_cast<std::size_t>(key)];
+}
+
+bool InputBuffer::wasPressed(sf::Keyboard::Scancode key) const noexcept
+{
+    return isTracked(key) && m_PressedThisStep[static_cast<std::size_t>(key)];
+}
+
+float InputBuffer::heldFraction(sf::Keyboard::Scancode key) const noexcept
+{
+    if (!isTracked(key))
+    {
+        return 0.0f;
+    }
+    return std::clamp(m_HeldFraction[static_cast<std::size_t>(key)], 0.0f, 1.0f);
+}
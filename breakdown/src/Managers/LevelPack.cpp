@@ -0,0 +1,341 @@
+#include <toml++/toml.hpp>
+
+#include "Managers/LevelPack.hpp"
+#include "Managers/ConfigBinding.hpp"
+#include "Managers/ConfigManager.hpp"
+#include "ECS/Components.hpp"
+#include "AssetKeys.hpp"
+#include "Utilities/BinaryIO.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr std::uint32_t PackMagic = 0x504C4442; // "BDLP"
+    constexpr std::uint32_t PackVersion = 1;
+
+    // magic, version, source stamp, level count
+    constexpr std::size_t HeaderSize = 4 + 4 + 8 + 8 + 8 + 4;
+    // per level: u64 offset, u32 size, u32 padding
+    constexpr std::size_t IndexEntrySize = 16;
+
+    // A [level_N] section as written in Levels.toml
+    struct LevelSource
+    {
+        float brickWidth{ 120.0f };
+        float brickHeight{ 40.0f };
+        float descentSpeed{ 0.0f };
+        std::vector<std::string> layout;
+
+        static constexpr std::array<ConfigField<LevelSource>, 4> Fields{ {
+            { "", "brickWidth",   &LevelSource::brickWidth },
+            { "", "brickHeight",  &LevelSource::brickHeight },
+            { "", "descentSpeed", &LevelSource::descentSpeed },
+            { "", "layout",       &LevelSource::layout },
+        } };
+    };
+
+    // Level layout codes (see Levels.toml). Empty spaces have no brick type.
+    std::uint8_t cellFromCode(char code)
+    {
+        switch (code)
+        {
+            case '.':
+            case ' ':
+                return LevelDef::EmptyCell;
+            case 'S':
+                return static_cast<std::uint8_t>(BrickType::Strong);
+            case 'G':
+                return static_cast<std::uint8_t>(BrickType::Gold);
+            case 'X':
+                return static_cast<std::uint8_t>(BrickType::Custom_1);
+            case 'Y':
+                return static_cast<std::uint8_t>(BrickType::Custom_2);
+            case 'N':
+            default:
+                return static_cast<std::uint8_t>(BrickType::Normal);
+        }
+    }
+
+    void packLevel(utils::BinaryWriter& writer, const LevelSource& level)
+    {
+        std::size_t columns = 0;
+        for (const auto& row : level.layout)
+        {
+            columns = std::max(columns, row.size());
+        }
+
+        writer.write(level.brickWidth);
+        writer.write(level.brickHeight);
+        writer.write(level.descentSpeed);
+        writer.write(static_cast<std::uint16_t>(columns));
+        writer.write(static_cast<std::uint16_t>(level.layout.size()));
+
+        for (const auto& row : level.layout)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+            {
+                // short rows are padded with empty cells
+                writer.write(column < row.size() ? cellFromCode(row[column]) : LevelDef::EmptyCell);
+            }
+        }
+    }
+}
+
+bool LevelPack::open(std::string_view packPath, std::string_view sourcePath, ConfigManager& configManager)
+{
+    m_PackPath = packPath;
+    m_SourcePath = sourcePath;
+
+    if (map(packPath))
+    {
+        bool hasSource = utils::statFile(sourcePath).has_value();
+        std::optional<utils::FileStamp> packed = packedSourceStamp();
+        if (!hasSource || (packed && utils::fileMatches(sourcePath, *packed)))
+        {
+            logger::Info(std::format("Level pack mapped: {} levels.", m_LevelCount));
+            return true;
+        }
+        logger::Info(std::format("{} changed; recompiling the level pack.", sourcePath));
+        m_File.close();
+    }
+
+    if (!compile(sourcePath, packPath, configManager) || !map(packPath))
+    {
+        logger::Error(std::format("No usable level pack at {}.", packPath));
+        return false;
+    }
+
+    logger::Info(std::format("Level pack compiled and mapped: {} levels.", m_LevelCount));
+    return true;
+}
+
+bool LevelPack::rebuild(ConfigManager& configManager, utils::JobSystem& jobs)
+{
+    // a prefetch may still be reading the old mapping
+    if (m_Prefetch.job.isValid())
+    {
+        jobs.wait(m_Prefetch.job);
+    }
+    m_Prefetch = {};
+    m_File.close();
+
+    if (!compile(m_SourcePath, m_PackPath, configManager) || !map(m_PackPath))
+    {
+        logger::Error(std::format("Level pack rebuild failed; no levels until {} is fixed.", m_SourcePath));
+        return false;
+    }
+
+    logger::Info(std::format("Level pack rebuilt: {} levels.", m_LevelCount));
+    return true;
+}
+
+bool LevelPack::map(std::string_view packPath)
+{
+    m_LevelCount = 0;
+    if (!m_File.open(packPath))
+    {
+        return false;
+    }
+
+    utils::BinaryReader reader(m_File.data());
+    bool valid = reader.read<std::uint32_t>() == PackMagic
+              && reader.read<std::uint32_t>() == PackVersion;
+    // skip the stamp, see packedSourceStamp()
+    reader.readBytes(8 + 8 + 8);
+    auto levelCount = reader.read<std::uint32_t>();
+
+    // the index has to fit; records are bounds checked when decoded
+    valid = valid && !reader.failed()
+         && m_File.data().size() >= HeaderSize + std::size_t{ levelCount } * IndexEntrySize;
+    if (!valid)
+    {
+        logger::Warn(std::format("Level pack {} is invalid.", packPath));
+        m_File.close();
+        return false;
+    }
+
+    m_LevelCount = levelCount;
+    return true;
+}
+
+std::optional<utils::FileStamp> LevelPack::packedSourceStamp() const
+{
+    utils::BinaryReader reader(m_File.data());
+    reader.readBytes(8);
+
+    utils::FileStamp stamp;
+    stamp.mtime = reader.read<std::int64_t>();
+    stamp.size = reader.read<std::uint64_t>();
+    stamp.hash = reader.read<std::uint64_t>();
+    if (reader.failed())
+    {
+        return std::nullopt;
+    }
+    return stamp;
+}
+
+std::optional<LevelDef> LevelPack::decode(int levelNumber) const
+{
+    if (levelNumber < 1 || levelNumber > levelCount())
+    {
+        logger::Error(std::format("Level {} isn't in the level pack ({} levels).", levelNumber, m_LevelCount));
+        return std::nullopt;
+    }
+
+    auto data = m_File.data();
+    utils::BinaryReader indexReader(data.subspan(HeaderSize + static_cast<std::size_t>(levelNumber - 1) * IndexEntrySize));
+    auto offset = indexReader.read<std::uint64_t>();
+    auto size = indexReader.read<std::uint32_t>();
+    if (indexReader.failed() || offset > data.size() || size > data.size() - offset)
+    {
+        logger::Error(std::format("Level {} has a bad index entry.", levelNumber));
+        return std::nullopt;
+    }
+
+    utils::BinaryReader reader(data.subspan(offset, size));
+    LevelDef level;
+    level.brickWidth = reader.read<float>();
+    level.brickHeight = reader.read<float>();
+    level.descentSpeed = reader.read<float>();
+    level.columns = reader.read<std::uint16_t>();
+    level.rows = reader.read<std::uint16_t>();
+
+    auto cells = reader.readBytes(std::size_t{ level.columns } * level.rows);
+    if (reader.failed())
+    {
+        logger::Error(std::format("Level {} record is truncated.", levelNumber));
+        return std::nullopt;
+    }
+
+    level.cells.resize(cells.size());
+    std::transform(cells.begin(), cells.end(), level.cells.begin(),
+                   [](std::byte cell) { return static_cast<std::uint8_t>(cell); });
+    return level;
+}
+
+void LevelPack::prefetch(int levelNumber, utils::JobSystem& jobs)
+{
+    if (m_Prefetch.job.isValid())
+    {
+        if (m_Prefetch.levelNumber == levelNumber)
+        {
+            return;
+        }
+        jobs.wait(m_Prefetch.job);
+    }
+
+    auto result = std::make_shared<std::optional<LevelDef>>();
+    m_Prefetch.levelNumber = levelNumber;
+    m_Prefetch.result = result;
+    m_Prefetch.job = jobs.schedule([this, levelNumber, result]() {
+        *result = decode(levelNumber);
+    });
+}
+
+std::optional<LevelDef> LevelPack::acquire(int levelNumber, utils::JobSystem& jobs)
+{
+    if (m_Prefetch.job.isValid() && m_Prefetch.levelNumber == levelNumber)
+    {
+        jobs.wait(m_Prefetch.job);
+        std::optional<LevelDef> level = std::move(*m_Prefetch.result);
+        m_Prefetch = {};
+        return level;
+    }
+
+    return decode(levelNumber);
+}
+
+bool LevelPack::compile(std::string_view sourcePath, std::string_view packPath,
+                        ConfigManager& configManager)
+{
+    std::optional<utils::FileStamp> stamp = utils::statFile(sourcePath);
+    std::optional<std::uint64_t> hash = utils::hashFile(sourcePath);
+    if (!stamp || !hash)
+    {
+        logger::Error(std::format("Can't compile levels: {} not found.", sourcePath));
+        return false;
+    }
+    stamp->hash = *hash;
+
+    if (!configManager.isLoaded(Assets::Configs::Levels))
+    {
+        configManager.loadConfig(Assets::Configs::Levels, sourcePath);
+    }
+    const toml::table* table = configManager.getConfigTable(Assets::Configs::Levels);
+    if (!table)
+    {
+        return false;
+    }
+
+    int levelCount = std::max(configManager.getConfigValue<int>(
+                                Assets::Configs::Levels, "totalLevels").value_or(1), 0);
+
+    // Records first, so their offsets are known when writing the index
+    utils::BinaryWriter records;
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> index;
+    std::uint64_t recordsStart = HeaderSize + static_cast<std::uint64_t>(levelCount) * IndexEntrySize;
+    for (int levelNumber = 1; levelNumber <= levelCount; ++levelNumber)
+    {
+        std::string section = std::format("level_{}", levelNumber);
+        LevelSource level;
+        ConfigBinding::bind<LevelSource>(*table, Assets::Configs::Levels, LevelSource::Fields, level, section);
+
+        std::size_t start = records.buffer().size();
+        packLevel(records, level);
+        index.emplace_back(recordsStart + start, static_cast<std::uint32_t>(records.buffer().size() - start));
+    }
+
+    utils::BinaryWriter writer;
+    writer.write(PackMagic);
+    writer.write(PackVersion);
+    writer.write(stamp->mtime);
+    writer.write(stamp->size);
+    writer.write(stamp->hash);
+    writer.write(static_cast<std::uint32_t>(levelCount));
+    for (const auto& [offset, size] : index)
+    {
+        writer.write(offset);
+        writer.write(size);
+        writer.write(std::uint32_t{ 0 });
+    }
+    writer.writeBytes(records.buffer());
+
+    // Write next to it and swap, like the config cache
+    std::string tempPath = std::string(packPath) + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        const auto& bytes = writer.buffer();
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+            logger::Error(std::format("Couldn't write level pack {}.", tempPath));
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, packPath, error);
+    if (error)
+    {
+        logger::Error(std::format("Couldn't replace level pack {}: {}", packPath, error.message()));
+        return false;
+    }
+
+    logger::Info(std::format("Compiled {} levels from {} into {}.", levelCount, sourcePath, packPath));
+    return true;
+}
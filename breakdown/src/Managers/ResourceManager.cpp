@@ -19,6 +19,11 @@ void ResourceManager::loadAssetsFromManifest(std::string_view filepath)
         return;
     }
 
+    loadAssetsFromManifest(manifestFile.table());
+}
+
+void ResourceManager::loadAssetsFromManifest(const toml::table& manifestFile)
+{
     // Load in order of manifest/ResourceManager data members
     // Load Fonts
     if (auto fonts = manifestFile["fonts"].as_array())
@@ -1,7 +1,13 @@
 #include "Managers/StateManager.hpp"
+#include "Utilities/Logger.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <typeindex>
 #include <utility>
 #include <memory>
+#include <string_view>
 
 StateManager::StateManager(AppContext& context)
     : m_AppContext(context)
@@ -14,46 +20,145 @@ StateManager::~StateManager()
 
 void StateManager::pushState(std::unique_ptr<State> state)
 {
+    cancelPreparation();
     m_PendingChanges.push_back({ StateAction::Push, std::move(state) });
 }
 
 void StateManager::popState()
 {
+    cancelPreparation();
     m_PendingChanges.push_back({ StateAction::Pop, nullptr });
 }
 
 void StateManager::replaceState(std::unique_ptr<State> state)
 {
+    cancelPreparation();
     m_PendingChanges.push_back({ StateAction::Replace, std::move(state) });
 }
 
-void StateManager::processPending()
+void StateManager::replaceStateWhenReady(std::function<void()> prepare,
+                                         std::function<std::unique_ptr<State>()> commit)
 {
+    if (m_Preparation)
+    {
+        // e.g. a double click on Play
+        logger::Warn("A state is already being prepared; ignoring the new one.");
+        return;
+    }
+
+    m_Preparation.emplace();
+    m_Preparation->job = m_AppContext.m_JobSystem->schedule(std::move(prepare));
+    m_Preparation->commit = std::move(commit);
+}
+
+void StateManager::cancelPreparation()
+{
+    // Once the LoadingState is up nothing but the commit should change the stack
+    if (m_Preparation && !m_Preparation->showingLoading)
+    {
+        // the job still runs to completion, its result is just never committed
+        logger::Info("State change requested; dropping the state being prepared.");
+        m_Cancelled.push_back(m_Preparation->job);
+        m_Preparation.reset();
+    }
+}
+
+bool StateManager::isPreparing() const noexcept
+{
+    return m_Preparation.has_value()
+        || std::ranges::any_of(m_Cancelled, [](const utils::JobHandle& job) { return !job.isDone(); });
+}
+
+bool StateManager::processPreparation()
+{
+    std::erase_if(m_Cancelled, [](const utils::JobHandle& job) { return job.isDone(); });
+
+    if (!m_Preparation)
+    {
+        return false;
+    }
+
+    if (!m_Preparation->job.isDone())
+    {
+        if (!m_Preparation->showingLoading && m_Preparation->elapsed.getElapsedTime() >= LoadingDelay)
+        {
+            enterState(std::make_unique<LoadingState>(m_AppContext));
+            m_Preparation->showingLoading = true;
+            return true;
+        }
+        return false;
+    }
+
+    bool showingLoading = m_Preparation->showingLoading;
+    std::unique_ptr<State> state = m_Preparation->commit();
+    m_Preparation.reset();
+
+    if (showingLoading)
+    {
+        exitState();
+    }
+    m_PendingChanges.push_back({ StateAction::Replace, std::move(state) });
+    return true;
+}
+
+bool StateManager::processPending()
+{
+    bool prepared = processPreparation();
+    if (m_PendingChanges.empty())
+    {
+        return prepared;
+    }
+
     for (auto& change : m_PendingChanges)
     {
         switch (change.action)
         {
             case StateAction::Push:
-                m_States.push_back(std::move(change.state));
+                enterState(std::move(change.state));
                 break;
             case StateAction::Pop:
-                if (!m_States.empty())
-                {
-                    m_States.pop_back();
-                }
+                exitState();
                 break;
             case StateAction::Replace:
-                if (!m_States.empty())
-                {
-                    m_States.pop_back();
-                }
-                m_States.push_back(std::move(change.state));
+                exitState();
+                enterState(std::move(change.state));
                 break;
             default: 
                 break;
         }
     }
     m_PendingChanges.clear();
+
+    // The mouse may be over a button of the (new) top state without having moved
+    if (auto* current = getCurrentState())
+    {
+        current->refreshHover();
+    }
+    return true;
+}
+
+void StateManager::enterState(std::unique_ptr<State> state)
+{
+    state->onEnter();
+    m_States.push_back(std::move(state));
+}
+
+void StateManager::exitState()
+{
+    if (m_States.empty())
+    {
+        return;
+    }
+
+    std::unique_ptr<State> state = std::move(m_States.back());
+    m_States.pop_back();
+    state->onExit();
+
+    if (state->isReusable())
+    {
+        std::type_index type(typeid(*state));
+        m_Suspended.insert_or_assign(type, std::move(state));
+    }
 }
 
 State* StateManager::getCurrentState() noexcept
@@ -82,13 +187,22 @@ void StateManager::update(sf::Time deltaTime)
     }
 }
 
-void StateManager::render()
+void StateManager::onConfigReloaded(std::string_view configID)
+{
+    for (auto& state : m_States)
+    {
+        state->onConfigReloaded(configID);
+    }
+}
+
+void StateManager::render(RenderSnapshot& snapshot)
 {
     if (!m_States.empty())
     {
-        for (auto& state : m_States)
+        for (std::size_t i = 0; i < m_States.size(); ++i)
         {
-            state->render();
+            bool covered = (i + 1 < m_States.size());
+            m_States[i]->renderLayer(snapshot, covered);
         }
     }
 }
\ No newline at end of file
@@ -1,16 +1,14 @@
 #include <SFML/Window.hpp>
 
 #include "Managers/WindowManager.hpp"
-#include "Managers/ConfigManager.hpp"
 #include "Utilities/Logger.hpp"
-#include "AssetKeys.hpp"
 
 #include <memory>
 #include <stdexcept>
 
-WindowManager::WindowManager(ConfigManager& configManager)
+WindowManager::WindowManager(const WindowConfig& config)
     : m_MainWindow(nullptr)
-    , m_ConfigManager(configManager)
+    , m_Config(config)
 {
 }
 
@@ -29,16 +27,9 @@ bool WindowManager::createMainWindow()
     }
     else 
     {
-        unsigned int width = m_ConfigManager.getConfigValue<unsigned int>(
-            Assets::Configs::Window, "mainWindow", "X").value_or(800u);
-        unsigned int height = m_ConfigManager.getConfigValue<unsigned int>(
-            Assets::Configs::Window, "mainWindow", "Y").value_or(600u);
-        std::string title = m_ConfigManager.getConfigValue<std::string>(
-            Assets::Configs::Window, "mainWindow", "Title").value_or("Error parsing title");
-        
         m_MainWindow = std::make_unique<sf::RenderWindow>(
-            sf::VideoMode({ width, height }),
-            title,
+            sf::VideoMode({ m_Config.width, m_Config.height }),
+            m_Config.title,
             // Always use default style + windowed for now
             sf::Style::Default,
             sf::State::Windowed
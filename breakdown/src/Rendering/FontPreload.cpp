@@ -0,0 +1,64 @@
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/FontPreload.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr char32_t FirstPrintable = U' ';
+    constexpr char32_t LastPrintable = U'~';
+
+    using FontSize = std::pair<const sf::Font*, unsigned int>;
+
+    // Main thread only, so no locking
+    std::vector<FontSize> s_Preloaded;
+    std::vector<FontSize> s_Reported;
+}
+
+namespace FontPreload
+{
+    void preload(const sf::Font& font, std::span<const unsigned int> characterSizes)
+    {
+        for (unsigned int characterSize : characterSizes)
+        {
+            for (char32_t codePoint = FirstPrintable; codePoint <= LastPrintable; ++codePoint)
+            {
+                (void)font.getGlyph(codePoint, characterSize, false);
+            }
+            // the page texture exists now, and only grows if a glyph is added
+            (void)font.getTexture(characterSize);
+
+            if (!isPreloaded(font, characterSize))
+            {
+                s_Preloaded.emplace_back(&font, characterSize);
+            }
+        }
+    }
+
+    bool isPreloaded(const sf::Font& font, unsigned int characterSize)
+    {
+        return std::ranges::find(s_Preloaded, FontSize{ &font, characterSize }) != s_Preloaded.end();
+    }
+
+    bool check(const sf::Font& font, unsigned int characterSize)
+    {
+        if (isPreloaded(font, characterSize))
+        {
+            return true;
+        }
+
+        if (std::ranges::find(s_Reported, FontSize{ &font, characterSize }) == s_Reported.end())
+        {
+            s_Reported.emplace_back(&font, characterSize);
+            logger::Error(std::format("Text drawn at size {} wasn't preloaded; add it to Assets::TextSizes.",
+                                      characterSize));
+        }
+        return false;
+    }
+}
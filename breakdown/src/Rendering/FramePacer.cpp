@@ -0,0 +1,145 @@
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/FramePacer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <optional>
+#include <string_view>
+#include <thread>
+
+FramePacer::FramePacer(PacingMode mode, unsigned int targetFps, std::chrono::microseconds spinMargin)
+    : m_Mode(mode)
+    , m_Period(std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double>(1.0 / std::max(targetFps, 1u))))
+    , m_SpinMargin(spinMargin)
+{
+}
+
+void FramePacer::apply(sf::RenderWindow& window) const
+{
+    // We do the limiting ourselves (or not at all)
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(m_Mode == PacingMode::VSync);
+}
+
+void FramePacer::endFrame(const std::function<void()>& pollEvents)
+{
+    if (m_Mode == PacingMode::Hybrid)
+    {
+        Clock::time_point now = Clock::now();
+        if (m_NextDeadline == Clock::time_point{} || now - m_NextDeadline > m_Period)
+        {
+            // first frame, or more than a frame late: restart the schedule rather
+            // than rushing through a burst of frames to catch up
+            m_NextDeadline = now + m_Period;
+        }
+        waitUntil(m_NextDeadline, pollEvents);
+        m_NextDeadline += m_Period;
+    }
+
+    record(Clock::now());
+}
+
+void FramePacer::resync() noexcept
+{
+    m_NextDeadline = Clock::time_point{};
+    m_HasLastFrame = false;
+}
+
+void FramePacer::waitUntil(Clock::time_point deadline, const std::function<void()>& pollEvents) const
+{
+    // Coarse part: the OS may wake us late, so stop sleeping early
+    Clock::time_point sleepUntil = deadline - m_SpinMargin;
+    while (Clock::now() < sleepUntil)
+    {
+        if (!pollEvents)
+        {
+            std::this_thread::sleep_until(sleepUntil);
+            break;
+        }
+        std::this_thread::sleep_until(std::min(sleepUntil, Clock::now() + PollInterval));
+        pollEvents();
+    }
+
+    // Fine part
+    while (Clock::now() < deadline)
+    {
+    }
+}
+
+void FramePacer::record(Clock::time_point now) noexcept
+{
+    if (m_HasLastFrame)
+    {
+        m_History[m_HistoryNext] = std::chrono::duration<float, std::milli>(now - m_LastFrame).count();
+        m_HistoryNext = (m_HistoryNext + 1) % HistorySize;
+        m_HistoryCount = std::min(m_HistoryCount + 1, HistorySize);
+    }
+    m_LastFrame = now;
+    m_HasLastFrame = true;
+}
+
+FrameStats FramePacer::stats() const noexcept
+{
+    FrameStats result;
+    result.samples = m_HistoryCount;
+    if (m_HistoryCount == 0)
+    {
+        return result;
+    }
+
+    float sum = 0.0f;
+    result.minMs = m_History[0];
+    result.maxMs = m_History[0];
+    for (std::size_t i = 0; i < m_HistoryCount; ++i)
+    {
+        sum += m_History[i];
+        result.minMs = std::min(result.minMs, m_History[i]);
+        result.maxMs = std::max(result.maxMs, m_History[i]);
+    }
+    result.meanMs = sum / static_cast<float>(m_HistoryCount);
+
+    float variance = 0.0f;
+    for (std::size_t i = 0; i < m_HistoryCount; ++i)
+    {
+        float diff = m_History[i] - result.meanMs;
+        variance += diff * diff;
+    }
+    result.stdDevMs = std::sqrt(variance / static_cast<float>(m_HistoryCount));
+
+    return result;
+}
+
+std::optional<PacingMode> FramePacer::parseMode(std::string_view name) noexcept
+{
+    if (name == "uncapped")
+    {
+        return PacingMode::Uncapped;
+    }
+    if (name == "vsync")
+    {
+        return PacingMode::VSync;
+    }
+    if (name == "hybrid")
+    {
+        return PacingMode::Hybrid;
+    }
+    return std::nullopt;
+}
+
+std::string_view FramePacer::modeName(PacingMode mode) noexcept
+{
+    switch (mode)
+    {
+        case PacingMode::Uncapped:
+            return "uncapped";
+        case PacingMode::VSync:
+            return "vsync";
+        case PacingMode::Hybrid:
+            return "hybrid";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,142 @@
+#include "Rendering/LatencyProbe.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+    float toMs(LatencyProbe::Clock::duration duration) noexcept
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    // Nearest-rank percentile of sorted values
+    float percentile(const std::vector<float>& sorted, float fraction) noexcept
+    {
+        if (sorted.empty())
+        {
+            return 0.0f;
+        }
+        auto rank = static_cast<std::size_t>(fraction * static_cast<float>(sorted.size() - 1) + 0.5f);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+}
+
+void LatencyProbe::onInputConsumed(Clock::time_point inputTime, std::uint64_t tick)
+{
+    m_Pending.push_back({ inputTime, Clock::now(), tick });
+}
+
+void LatencyProbe::takeFrameInputs(std::vector<InputStamp>& out)
+{
+    out.insert(out.end(), m_Pending.begin(), m_Pending.end());
+    m_Pending.clear();
+}
+
+void LatencyProbe::onPresented(std::span<const InputStamp> inputs, Clock::time_point presentTime)
+{
+    std::scoped_lock lock(m_Mutex);
+    for (const InputStamp& stamp : inputs)
+    {
+        float latencyMs = toMs(presentTime - stamp.input);
+
+        m_History[m_HistoryNext] = latencyMs;
+        m_ToTickHistory[m_HistoryNext] = toMs(stamp.consumed - stamp.input);
+        m_HistoryNext = (m_HistoryNext + 1) % HistorySize;
+        m_HistoryCount = std::min(m_HistoryCount + 1, HistorySize);
+
+        auto bucket = static_cast<std::size_t>(std::max(latencyMs, 0.0f));
+        ++m_Histogram[std::min(bucket, BucketCount - 1)];
+        ++m_TotalSamples;
+        m_TotalMs += latencyMs;
+        m_MaxMs = std::max(m_MaxMs, latencyMs);
+    }
+}
+
+LatencyStats LatencyProbe::stats() const
+{
+    std::vector<float> sorted;
+    float toTickSum = 0.0f;
+    {
+        std::scoped_lock lock(m_Mutex);
+        sorted.assign(m_History.begin(), m_History.begin() + m_HistoryCount);
+        for (std::size_t i = 0; i < m_HistoryCount; ++i)
+        {
+            toTickSum += m_ToTickHistory[i];
+        }
+    }
+
+    LatencyStats stats;
+    stats.samples = sorted.size();
+    if (sorted.empty())
+    {
+        return stats;
+    }
+
+    std::ranges::sort(sorted);
+    float sum = 0.0f;
+    for (float value : sorted)
+    {
+        sum += value;
+    }
+
+    float count = static_cast<float>(sorted.size());
+    stats.meanToTickMs = toTickSum / count;
+    stats.meanMs = sum / count;
+    stats.p50Ms = percentile(sorted, 0.50f);
+    stats.p95Ms = percentile(sorted, 0.95f);
+    stats.p99Ms = percentile(sorted, 0.99f);
+    stats.maxMs = sorted.back();
+    return stats;
+}
+
+bool LatencyProbe::writeReport(std::string_view filepath) const
+{
+    LatencyStats recent = stats();
+
+    std::string report;
+    std::uint64_t totalSamples = 0;
+    {
+        std::scoped_lock lock(m_Mutex);
+        totalSamples = m_TotalSamples;
+
+        double meanMs = m_TotalSamples > 0 ? m_TotalMs / static_cast<double>(m_TotalSamples) : 0.0;
+        report += "# Input-to-present latency (key event -> display())\n";
+        report += std::format("samples = {}\nmeanMs = {:.3f}\nmaxMs = {:.3f}\n",
+                              m_TotalSamples, meanMs, m_MaxMs);
+        report += std::format("# last {} inputs\n", recent.samples);
+        report += std::format("recentMeanToTickMs = {:.3f}\nrecentMeanMs = {:.3f}\n"
+                              "recentP50Ms = {:.3f}\nrecentP95Ms = {:.3f}\nrecentP99Ms = {:.3f}\n",
+                              recent.meanToTickMs, recent.meanMs, recent.p50Ms,
+                              recent.p95Ms, recent.p99Ms);
+
+        report += "# histogram: bucket start (ms), count\n";
+        for (std::size_t i = 0; i < BucketCount; ++i)
+        {
+            if (m_Histogram[i] > 0)
+            {
+                report += std::format("{}{}, {}\n", i, (i == BucketCount - 1) ? "+" : "",
+                                      m_Histogram[i]);
+            }
+        }
+    }
+
+    std::ofstream file{ std::string(filepath), std::ios::trunc };
+    if (!file)
+    {
+        logger::Error(std::format("Couldn't write latency report to {}.", filepath));
+        return false;
+    }
+    file << report;
+
+    logger::Info(std::format("Latency report written to {} ({} inputs).", filepath, totalSamples));
+    return true;
+}
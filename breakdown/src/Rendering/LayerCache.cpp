@@ -0,0 +1,58 @@
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/LayerCache.hpp"
+#include "Rendering/RenderSnapshot.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <memory>
+
+const sf::Texture* LayerCache::getTexture(const LayerRef& layer)
+{
+    if (!layer.content || layer.size.x == 0 || layer.size.y == 0)
+    {
+        return nullptr;
+    }
+
+    Entry& entry = m_Entries[layer.id];
+    entry.used = true;
+
+    bool needsRender = !entry.texture || entry.version != layer.version;
+    if (!entry.texture || entry.texture->getSize() != layer.size)
+    {
+        entry.texture = std::make_unique<sf::RenderTexture>();
+        if (!entry.texture->resize(layer.size))
+        {
+            logger::Error(std::format("Couldn't create a {}x{} layer texture.", layer.size.x, layer.size.y));
+            entry.texture.reset();
+            return nullptr;
+        }
+        needsRender = true;
+    }
+
+    if (needsRender)
+    {
+        layer.content->render(*entry.texture, *this);
+        entry.texture->display();
+        entry.version = layer.version;
+    }
+
+    return &entry.texture->getTexture();
+}
+
+void LayerCache::endFrame()
+{
+    std::erase_if(m_Entries, [](auto& item) {
+        bool unused = !item.second.used;
+        item.second.used = false;
+        return unused;
+    });
+}
+
+std::uint64_t LayerCache::nextLayerId()
+{
+    static std::atomic<std::uint64_t> nextId{ 1 };
+    return nextId.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,119 @@
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/RenderSnapshot.hpp"
+#include "Rendering/FontPreload.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+void RenderSnapshot::clear()
+{
+    m_Items.clear();
+    m_QuadVertices.clear();
+    m_InputStamps.clear();
+    m_ClearColor = sf::Color::Black;
+}
+
+void RenderSnapshot::draw(const sf::RectangleShape& shape)
+{
+    m_Items.emplace_back(shape);
+}
+
+void RenderSnapshot::draw(const sf::CircleShape& shape)
+{
+    m_Items.emplace_back(shape);
+}
+
+void RenderSnapshot::draw(const sf::Text& text)
+{
+    // The render thread reads the font while this thread records, which is only safe
+    // for sizes loaded up front (anything else adds glyphs while it draws)
+    FontPreload::check(text.getFont(), text.getCharacterSize());
+    // Lay the text out here, so the render thread only reads the layout
+    (void)text.getLocalBounds();
+    m_Items.emplace_back(text);
+}
+
+void RenderSnapshot::draw(const sf::Sprite& sprite)
+{
+    m_Items.emplace_back(sprite);
+}
+
+void RenderSnapshot::drawBatched(const sf::RectangleShape& shape)
+{
+    if (shape.getTexture() || shape.getOutlineThickness() != 0.0f)
+    {
+        draw(shape);
+        return;
+    }
+
+    // Extend the last batch if nothing else was drawn in between (keeps draw order)
+    if (m_Items.empty() || !std::holds_alternative<QuadBatch>(m_Items.back()))
+    {
+        m_Items.emplace_back(QuadBatch{ m_QuadVertices.size(), 0 });
+    }
+
+    const sf::Transform& transform = shape.getTransform();
+    sf::Vector2f size = shape.getSize();
+    sf::Color color = shape.getFillColor();
+
+    std::array<sf::Vector2f, 4> corners = {
+        transform.transformPoint({ 0.0f, 0.0f }),
+        transform.transformPoint({ size.x, 0.0f }),
+        transform.transformPoint({ size.x, size.y }),
+        transform.transformPoint({ 0.0f, size.y })
+    };
+
+    // two triangles per quad
+    constexpr std::array<std::size_t, 6> triangleCorners = { 0, 1, 2, 0, 2, 3 };
+    for (std::size_t index : triangleCorners)
+    {
+        m_QuadVertices.push_back(sf::Vertex{ corners[index], color });
+    }
+    std::get<QuadBatch>(m_Items.back()).vertexCount += 6;
+}
+
+void RenderSnapshot::drawLayer(LayerRef layer)
+{
+    m_Items.emplace_back(std::move(layer));
+}
+
+void RenderSnapshot::render(sf::RenderTarget& target, LayerCache& layers) const
+{
+    render(target, layers, m_View);
+}
+
+void RenderSnapshot::render(sf::RenderTarget& target, LayerCache& layers, const sf::View& view) const
+{
+    target.setView(view);
+    target.clear(m_ClearColor);
+
+    for (const auto& item : m_Items)
+    {
+        std::visit([this, &target, &layers](const auto& drawable) {
+            using Item = std::decay_t<decltype(drawable)>;
+            if constexpr (std::is_same_v<Item, QuadBatch>)
+            {
+                target.draw(m_QuadVertices.data() + drawable.firstVertex, drawable.vertexCount,
+                            sf::PrimitiveType::Triangles);
+            }
+            else if constexpr (std::is_same_v<Item, LayerRef>)
+            {
+                if (const sf::Texture* texture = layers.getTexture(drawable))
+                {
+                    sf::Sprite layer(*texture);
+                    sf::Vector2f textureSize(texture->getSize());
+                    layer.setScale({ drawable.area.x / textureSize.x, drawable.area.y / textureSize.y });
+                    target.draw(layer);
+                }
+            }
+            else
+            {
+                target.draw(drawable);
+            }
+        }, item);
+    }
+}
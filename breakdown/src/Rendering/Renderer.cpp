@@ -0,0 +1,203 @@
+#include <SFML/Graphics.hpp>
+
+#include "Rendering/Renderer.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+Renderer::Renderer(sf::RenderWindow& window, const RendererSettings& settings)
+    : m_Window(window)
+    , m_View(window.getView())
+    , m_Threaded(settings.threaded)
+    , m_InternalResolution(settings.internalResolution)
+    , m_ConfiguredResolution(settings.internalResolution)
+    , m_SmoothUpscale(settings.smoothUpscale)
+{
+    if (m_InternalResolution)
+    {
+        logger::Info(std::format("Rendering at {}x{}, upscaled ({}).",
+            m_InternalResolution->x, m_InternalResolution->y, m_SmoothUpscale ? "linear" : "nearest"));
+    }
+
+    if (m_Threaded)
+    {
+        // a GL context can only be active on one thread at a time
+        if (!m_Window.setActive(false))
+        {
+            logger::Warn("Couldn't release the window context; rendering on the main thread.");
+            m_Threaded = false;
+            return;
+        }
+        m_Thread = std::thread(&Renderer::renderLoop, this);
+        logger::Info("Render thread started.");
+    }
+    else
+    {
+        logger::Info("Rendering on the main thread.");
+    }
+}
+
+Renderer::~Renderer()
+{
+    stopThread();
+}
+
+RenderSnapshot& Renderer::beginFrame()
+{
+    RenderSnapshot& snapshot = m_Snapshots[m_WriteIndex];
+    snapshot.clear();
+    snapshot.setView(m_View);
+    return snapshot;
+}
+
+sf::Vector2u Renderer::getViewPixelSize() const
+{
+    if (m_ConfiguredResolution)
+    {
+        return *m_ConfiguredResolution;
+    }
+
+    sf::IntRect viewport = m_Window.getViewport(m_View);
+    return { static_cast<unsigned int>(std::max(viewport.size.x, 1)),
+             static_cast<unsigned int>(std::max(viewport.size.y, 1)) };
+}
+
+void Renderer::endFrame()
+{
+    if (!m_Window.isOpen())
+    {
+        return;
+    }
+
+    if (!m_Threaded)
+    {
+        present(m_Snapshots[m_WriteIndex]);
+        return;
+    }
+
+    {
+        std::unique_lock lock(m_Mutex);
+        // at most one frame in flight: wait for the render thread to take the last one
+        m_Condition.wait(lock, [this]() { return !m_HasReady || m_Stopping; });
+        if (m_Stopping)
+        {
+            return;
+        }
+        std::swap(m_WriteIndex, m_ReadyIndex);
+        m_HasReady = true;
+    }
+    m_Condition.notify_all();
+}
+
+void Renderer::closeWindow()
+{
+    stopThread();
+    m_Window.close();
+}
+
+void Renderer::renderLoop()
+{
+    if (!m_Window.setActive(true))
+    {
+        logger::Error("Render thread couldn't activate the window context.");
+    }
+
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_Mutex);
+            m_Condition.wait(lock, [this]() { return m_HasReady || m_Stopping; });
+            if (m_Stopping)
+            {
+                break;
+            }
+            std::swap(m_DrawIndex, m_ReadyIndex);
+            m_HasReady = false;
+        }
+        // let the main thread publish the next frame while this one draws
+        m_Condition.notify_all();
+
+        present(m_Snapshots[m_DrawIndex]);
+    }
+
+    (void)m_Window.setActive(false);
+}
+
+void Renderer::stopThread()
+{
+    if (!m_Thread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+    m_Thread.join();
+
+    // the main thread owns the context again (for close() and any final drawing)
+    m_Threaded = false;
+    (void)m_Window.setActive(true);
+    logger::Info("Render thread stopped.");
+}
+
+void Renderer::present(const RenderSnapshot& snapshot)
+{
+    if (m_InternalResolution)
+    {
+        presentUpscaled(snapshot);
+    }
+    else
+    {
+        snapshot.render(m_Window, m_Layers);
+    }
+    m_Window.display();
+    if (m_LatencyProbe && !snapshot.inputStamps().empty())
+    {
+        m_LatencyProbe->onPresented(snapshot.inputStamps(), LatencyProbe::Clock::now());
+    }
+    m_Layers.endFrame();
+}
+
+void Renderer::presentUpscaled(const RenderSnapshot& snapshot)
+{
+    // Created here since it needs the drawing thread's GL context
+    if (!m_SceneTexture)
+    {
+        m_SceneTexture = std::make_unique<sf::RenderTexture>();
+        if (!m_SceneTexture->resize(*m_InternalResolution))
+        {
+            logger::Error(std::format("Couldn't create the {}x{} scene texture; rendering at window resolution.",
+                m_InternalResolution->x, m_InternalResolution->y));
+            m_SceneTexture.reset();
+            m_InternalResolution.reset();
+            snapshot.render(m_Window, m_Layers);
+            return;
+        }
+        m_SceneTexture->setSmooth(m_SmoothUpscale);
+    }
+
+    // The texture is the whole game area: same world rect, no letterbox bars
+    const sf::View& windowView = snapshot.getView();
+    sf::View sceneView = windowView;
+    sceneView.setViewport(sf::FloatRect({ 0.0f, 0.0f }, { 1.0f, 1.0f }));
+
+    snapshot.render(*m_SceneTexture, m_Layers, sceneView);
+    m_SceneTexture->display();
+
+    // Stretch it over the same world rect in the letterboxed window view
+    sf::Sprite scene(m_SceneTexture->getTexture());
+    sf::Vector2f textureSize(m_SceneTexture->getSize());
+    scene.setPosition(windowView.getCenter() - windowView.getSize() / 2.0f);
+    scene.setScale({ windowView.getSize().x / textureSize.x, windowView.getSize().y / textureSize.y });
+
+    m_Window.setView(windowView);
+    m_Window.clear(sf::Color::Black);
+    m_Window.draw(scene);
+}
@@ -16,8 +16,79 @@
 #include "Utilities/Logger.hpp"
 #include "AssetKeys.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <memory>
 #include <format>
+#include <string>
+
+//$ ----- State Implementation ----- //
+State::State(AppContext& context)
+    : m_AppContext(context)
+    , m_StateArena(utils::ArenaSizes::State)
+    , m_LayerId(LayerCache::nextLayerId())
+{
+    UISystems::connectUIHover(m_Registry, m_StateArena.resource());
+
+    // Hover and toggle overlays are the only things that change a static screen
+    m_Registry.on_construct<UIHover>().connect<&State::onLayerContentChanged>(*this);
+    m_Registry.on_destroy<UIHover>().connect<&State::onLayerContentChanged>(*this);
+    m_Registry.on_construct<GUIRedX>().connect<&State::onLayerContentChanged>(*this);
+    m_Registry.on_destroy<GUIRedX>().connect<&State::onLayerContentChanged>(*this);
+
+    // UI hover for every state; runs after anything a state subscribes at Default
+    m_Events.subscribe<sf::Event::MouseMoved>([this](const sf::Event::MouseMoved& event) {
+        sf::Vector2f mousePos = m_AppContext.m_MainWindow->mapPixelToCoords(
+                                    event.position, m_AppContext.m_Renderer->getView());
+        UISystems::uiHoverSystem(m_Registry, mousePos);
+        return EventResult::Pass;
+    }, EventPriority::Fallback);
+}
+
+void State::renderLayer(RenderSnapshot& snapshot, bool covered)
+{
+    if (!covered && !isStatic())
+    {
+        // live (e.g. the playfield): draw straight into the frame, re-freeze when covered
+        m_LayerContent.reset();
+        render(snapshot);
+        return;
+    }
+
+    sf::Vector2f targetSize = { m_AppContext.m_AppSettings.targetWidth,
+                                m_AppContext.m_AppSettings.targetHeight };
+
+    if (m_LayerDirty || !m_LayerContent)
+    {
+        auto content = std::make_shared<RenderSnapshot>();
+        content->setView(sf::View(sf::FloatRect({ 0.0f, 0.0f }, targetSize)));
+        content->setClearColor(sf::Color::Transparent);
+        render(*content);
+
+        m_LayerContent = std::move(content);
+        ++m_LayerVersion;
+        m_LayerDirty = false;
+    }
+
+    // As many pixels as the layer covers on screen, so it isn't upscaled in big windows
+    sf::Vector2u layerSize = m_AppContext.m_Renderer->getViewPixelSize();
+    snapshot.drawLayer({ m_LayerId, m_LayerVersion, layerSize, targetSize, m_LayerContent });
+}
+
+void State::refreshHover()
+{
+    auto* window = m_AppContext.m_MainWindow;
+    if (!window || !window->isOpen())
+    {
+        return;
+    }
+
+    sf::Vector2f mousePos = window->mapPixelToCoords(sf::Mouse::getPosition(*window),
+                                                     m_AppContext.m_Renderer->getView());
+    UISystems::uiHoverSystem(m_Registry, mousePos);
+}
 
 //$ ----- MenuState Implementation ----- //
 MenuState::MenuState(AppContext& context)
@@ -30,25 +101,18 @@ MenuState::MenuState(AppContext& context)
     logger::Info("MenuState initialized.");
 }
 
-MenuState::~MenuState()
-{
-    auto& registry = *m_AppContext.m_Registry;
-    auto view = registry.view<MenuUITag>();
-    registry.destroy(view.begin(), view.end());
-}
-
 void MenuState::update(sf::Time deltaTime)
 {
-    UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    // UI hover is event driven (State's MouseMoved subscriber), nothing to do per frame
 }
 
-void MenuState::render()
+void MenuState::render(RenderSnapshot& snapshot)
 {
-    UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    UISystems::uiRenderSystem(m_Registry, snapshot);
     // Render the text
     if (m_TitleText)
     {
-        m_AppContext.m_MainWindow->draw(*m_TitleText);
+        snapshot.draw(*m_TitleText);
     }
 }
 
@@ -82,16 +146,16 @@ void MenuState::initMenuButtons()
         return;
     }
 
-    EntityFactory::createButton(m_AppContext, *buttonFont, "Play", center,
+    EntityFactory::createButton(m_Registry, *buttonFont, "Play", center,
         [this]() {
-            auto playState = std::make_unique<PlayState>(m_AppContext);
-            m_AppContext.m_StateManager->replaceState(std::move(playState));
+            PlayState::load(m_AppContext);
         }
     );
-    EntityFactory::createButton(m_AppContext, *buttonFont, "Settings",
+    EntityFactory::createButton(m_Registry, *buttonFont, "Settings",
         {center.x, center.y + 150.0f},
         [this]() {
-            auto settingsState = std::make_unique<SettingsMenuState>(m_AppContext);
+            auto settingsState = m_AppContext.m_StateManager->reuseOrCreate<SettingsMenuState>();
+            settingsState->setFromPlayState(false);
             m_AppContext.m_StateManager->replaceState(std::move(settingsState));
         }
     );
@@ -99,16 +163,10 @@ void MenuState::initMenuButtons()
 
 void MenuState::assignStateEvents()
 {
-    m_StateEvents.onMouseButtonPress = [this](const sf::Event::MouseButtonPressed& event) {
-        UISystems::uiClickSystem(*m_AppContext.m_Registry, event);
-    };
-
-    m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
-        {
-            m_AppContext.m_MainWindow->close();
-        }
-    };
+    m_Events.subscribe<sf::Event::MouseButtonPressed>([this](const sf::Event::MouseButtonPressed& event) {
+        UISystems::uiClickSystem(m_Registry, event);
+        return EventResult::Consumed;
+    });
 }
 
 SettingsMenuState::SettingsMenuState(AppContext& context, bool fromPlayState)
@@ -117,23 +175,25 @@ SettingsMenuState::SettingsMenuState(AppContext& context, bool fromPlayState)
     initMenuButtons();
     assignStateEvents();
 
-    logger::Info("SettingsMenuState initialized.");
-}
+    // Labels and toggle overlays only change when the settings do
+    m_SettingsConnection = entt::sink{ context.m_AppSettings.changed }
+                               .connect<&SettingsMenuState::onSettingsChanged>(*this);
 
-SettingsMenuState::~SettingsMenuState()
-{
-    // Clean up Menu UI entities
-    auto& registry = *m_AppContext.m_Registry;
-    auto view = registry.view<SettingsUITag>();
-    registry.destroy(view.begin(), view.end());
+    logger::Info("SettingsMenuState initialized.");
 }
 
 void SettingsMenuState::update(sf::Time deltaTime)
 {
-    UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
-    UISystems::uiSettingsChecks(m_AppContext);
+    UISystems::uiSettingsChecks(m_AppContext, m_Registry);
+
+    // Update volume text (only after a settings change)
+    if (!m_VolumeTextDirty)
+    {
+        return;
+    }
+    m_VolumeTextDirty = false;
+    markLayerDirty();
 
-    // Update volume text
     if (m_MusicVolumeText.has_value())
     {
         m_MusicVolumeText->setString(std::to_string(
@@ -146,19 +206,30 @@ void SettingsMenuState::update(sf::Time deltaTime)
     }
 }
 
-void SettingsMenuState::render()
+void SettingsMenuState::onSettingsChanged(const AppSettings& /* settings */)
+{
+    m_VolumeTextDirty = true;
+
+    auto toggleView = m_Registry.view<UIToggleCond>();
+    for (auto entity : toggleView)
+    {
+        m_Registry.emplace_or_replace<UIDirty>(entity);
+    }
+}
+
+void SettingsMenuState::render(RenderSnapshot& snapshot)
 {
-    m_AppContext.m_MainWindow->draw(m_Background);
+    snapshot.draw(m_Background);
 
-    UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    UISystems::uiRenderSystem(m_Registry, snapshot);
 
     if (m_MusicVolumeText)
     {
-        m_AppContext.m_MainWindow->draw(*m_MusicVolumeText);
+        snapshot.draw(*m_MusicVolumeText);
     }
     if (m_SfxVolumeText)
     {
-        m_AppContext.m_MainWindow->draw(*m_SfxVolumeText);
+        snapshot.draw(*m_SfxVolumeText);
     }
 }
 
@@ -227,18 +298,16 @@ void SettingsMenuState::initMenuButtons()
     auto decreaseSfxVolume = [this]() {
         float currentVolume = m_AppContext.m_AppSettings.sfxVolume;
         m_AppContext.m_AppSettings.setSfxVolume(currentVolume - 10.0f);
-        m_SfxVolumeText->setString(std::to_string(static_cast<int>(m_AppContext.m_AppSettings.sfxVolume)));
     };
     auto increaseSfxVolume = [this]() {
         float currentVolume = m_AppContext.m_AppSettings.sfxVolume;
         m_AppContext.m_AppSettings.setSfxVolume(currentVolume + 10.0f);
-        m_SfxVolumeText->setString(std::to_string(static_cast<int>(m_AppContext.m_AppSettings.sfxVolume)));
     };
 
-    auto leftSfxArrow = EntityFactory::createLabeledButton(m_AppContext, *leftArrowButton,
+    auto leftSfxArrow = EntityFactory::createLabeledButton(m_Registry, *leftArrowButton,
                                             leftSfxArrowPos, decreaseSfxVolume, *font,
                                             UITags::Settings, "SFX Volume: ", 36);
-    auto rightSfxArrow = EntityFactory::createGUIButton(m_AppContext, *rightArrowButton,
+    auto rightSfxArrow = EntityFactory::createGUIButton(m_Registry, *rightArrowButton,
                                             rightSfxArrowPos, increaseSfxVolume,
                                             UITags::Settings);
 
@@ -262,10 +331,10 @@ void SettingsMenuState::initMenuButtons()
         m_AppContext.m_AppSettings.setMusicVolume((currentVolume + decAmount), *music);
         };
     // Adjust music arrows
-    auto leftMusicArrow = EntityFactory::createLabeledButton(m_AppContext, *leftArrowButton,
+    auto leftMusicArrow = EntityFactory::createLabeledButton(m_Registry, *leftArrowButton,
                                             leftMusicArrowPos, decreaseMusicVolume, *font,
                                             UITags::Settings, "Music Volume: ", 36);
-    auto rightMusicArrow = EntityFactory::createGUIButton(m_AppContext, *rightArrowButton,
+    auto rightMusicArrow = EntityFactory::createGUIButton(m_Registry, *rightArrowButton,
                                             rightMusicArrowPos, increaseMusicVolume,
                                             UITags::Settings);
 
@@ -273,35 +342,37 @@ void SettingsMenuState::initMenuButtons()
 
     // Mute music button
     auto toggleMusicMute = [this]() { m_AppContext.m_AppSettings.toggleMusicMute(); };
-    auto muteMusicButton = EntityFactory::createLabeledButton(m_AppContext, *buttonBackground,
+    auto muteMusicButton = EntityFactory::createLabeledButton(m_Registry, *buttonBackground,
                             muteMusicPos, toggleMusicMute, *font, UITags::Settings, "Mute Music",
                             36, sf::Color::White);
-    m_AppContext.m_Registry->emplace<UIToggleCond>(muteMusicButton, [this]() {
+    m_Registry.emplace<UIToggleCond>(muteMusicButton, [this]() {
         return m_AppContext.m_AppSettings.musicMuted;
     });
+    m_Registry.emplace<UIDirty>(muteMusicButton);
 
     // Mute SFX button
     auto toggleSfxMute = [this]() { m_AppContext.m_AppSettings.toggleSfxMute(); };
-    auto muteSfxButton = EntityFactory::createLabeledButton(m_AppContext, *buttonBackground,
+    auto muteSfxButton = EntityFactory::createLabeledButton(m_Registry, *buttonBackground,
                             muteSfxPos, toggleSfxMute, *font, UITags::Settings, "Mute SFX",
                             36, sf::Color::White);
-    m_AppContext.m_Registry->emplace<UIToggleCond>(muteSfxButton, [this]() {
+    m_Registry.emplace<UIToggleCond>(muteSfxButton, [this]() {
         return m_AppContext.m_AppSettings.sfxMuted;
     });
+    m_Registry.emplace<UIDirty>(muteSfxButton);
 
     // Back button
     sf::Vector2f backButtonSize = { 150.0f, 50.0f };
-    auto backButton = EntityFactory::createButton(m_AppContext, *font, "Back",
+    auto backButton = EntityFactory::createButton(m_Registry, *font, "Back",
         backButtonPos,
         [this]() {
             if (m_FromPlayState)
             {
-                auto pauseState = std::make_unique<PauseState>(m_AppContext);
+                auto pauseState = m_AppContext.m_StateManager->reuseOrCreate<PauseState>();
                 m_AppContext.m_StateManager->replaceState(std::move(pauseState));
             }
             else
             {
-                auto menuState = std::make_unique<MenuState>(m_AppContext);
+                auto menuState = m_AppContext.m_StateManager->reuseOrCreate<MenuState>();
                 m_AppContext.m_StateManager->replaceState(std::move(menuState));
             }
         },
@@ -312,46 +383,25 @@ void SettingsMenuState::initMenuButtons()
 
 void SettingsMenuState::assignStateEvents()
 {
-    m_StateEvents.onMouseButtonPress = [this](const sf::Event::MouseButtonPressed& event) {
-        UISystems::uiClickSystem(*m_AppContext.m_Registry, event);
-    };
-
-    m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
-        {
-            m_AppContext.m_MainWindow->close();
-        }
-    };
+    m_Events.subscribe<sf::Event::MouseButtonPressed>([this](const sf::Event::MouseButtonPressed& event) {
+        UISystems::uiClickSystem(m_Registry, event);
+        return EventResult::Consumed;
+    });
 }
 
 //$ ----- PlayState Implementation ----- //
 PlayState::PlayState(AppContext& context)
     : State(context)
 {
-    // Create game entities
-    m_DescentSpeed = EntityFactory::loadLevel(context, context.m_AppData.levelNumber);
-    EntityFactory::createPlayer(context);
-    EntityFactory::createBall(context);
-
-    // Create UI/HUD entities
-    sf::Vector2f windowSize = { context.m_AppSettings.targetWidth,
-                                context.m_AppSettings.targetHeight };
-    sf::Vector2f center = getWindowCenter();
+    CoreSystems::registerGroups(m_Registry);
 
-    sf::Font* scoreFont = context.m_ResourceManager->getResource<sf::Font>(
-                                                           Assets::Fonts::ScoreFont);
-    if (!scoreFont)
-    {
-        logger::Error("Couldn't load ScoreFont! Score Display will not be created.");
-    }
-    else
-    {
-        unsigned int scoreFontSize{ 32 };
-        sf::Vector2f scorePosition({ center.x, windowSize.y - 20.0f });
+    // Create game + HUD entities from the level snapshot (built once per level)
+    const LevelSnapshot& level = EntityFactory::getLevelSnapshot(context, context.m_AppData.levelNumber);
+    EntityFactory::spawnLevel(context, m_Registry, level);
+    m_DescentSpeed = level.descentSpeed;
 
-        EntityFactory::createScoreDisplay(context, *scoreFont, scoreFontSize,
-                                        sf::Color::White, scorePosition);
-    }
+    registerSystems();
+    initDebugText();
 
     // Handle Music
     m_Music = context.m_ResourceManager->getResource<sf::Music>(Assets::Musics::MainSong);
@@ -373,69 +423,242 @@ PlayState::PlayState(AppContext& context)
         }
     }
 
-    // Handle Input
-    m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        // "Global" Escape key
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
-        {
-            m_AppContext.m_MainWindow->close();
-        }
-        // State-specific Pause key
-        else if (event.scancode == sf::Keyboard::Scancode::P)
+    // Handle Input (Escape is global, see GlobalEventManager)
+    m_Events.subscribe<sf::Event::KeyPressed>([this](const sf::Event::KeyPressed& event) {
+        if (event.scancode == sf::Keyboard::Scancode::P)
         {
-            auto pauseState = std::make_unique<PauseState>(m_AppContext);
+            auto pauseState = m_AppContext.m_StateManager->reuseOrCreate<PauseState>();
             m_AppContext.m_StateManager->pushState(std::move(pauseState));
+            return EventResult::Consumed;
         }
-        else if (event.scancode == sf::Keyboard::Scancode::F12)
+        if (event.scancode == sf::Keyboard::Scancode::F12)
         {
             m_ShowDebug = !m_ShowDebug;
             logger::Warn(std::format("Debug mode toggled: {}", m_ShowDebug ? "On" : "Off"));
+            return EventResult::Consumed;
         }
-    };
+        return EventResult::Pass;
+    });
 
     logger::Info("PlayState initialized.");
 }
 
-PlayState::~PlayState()
+void PlayState::load(AppContext& context)
 {
-    // Clean up all game entities
-    auto& registry = *m_AppContext.m_Registry;
-    auto gameView = registry.view<RenderableTag>();
-    registry.destroy(gameView.begin(), gameView.end());
+    int levelNumber = context.m_AppData.levelNumber;
+    if (context.m_LevelSnapshots.contains(levelNumber))
+    {
+        context.m_StateManager->replaceState(std::make_unique<PlayState>(context));
+        return;
+    }
 
-    // Clean up all HUD entities
-    auto hudView = registry.view<HUDTag>();
-    registry.destroy(hudView.begin(), hudView.end());
+    // The level pack is main thread only, so the level is decoded (or taken from the
+    // prefetch) here. Staging runs on a worker; HUD text, spawning and music on the main thread
+    auto level = std::make_shared<std::optional<LevelDef>>(
+        context.m_LevelPack->acquire(levelNumber, *context.m_JobSystem));
+    auto staged = std::make_shared<LevelSnapshot>();
+    context.m_StateManager->replaceStateWhenReady(
+        [&context, levelNumber, level, staged]() {
+            *staged = EntityFactory::buildLevelSnapshot(context, levelNumber, *level);
+        },
+        [&context, staged]() -> std::unique_ptr<State> {
+            EntityFactory::storeLevelSnapshot(context, std::move(*staged));
+            return std::make_unique<PlayState>(context);
+        });
 }
 
 void PlayState::update(sf::Time deltaTime)
 {
-    // Call game logic systems
-    CoreSystems::handlePlayerInput(m_AppContext);
-    CoreSystems::movementSystem(m_AppContext, deltaTime);
-    CoreSystems::collisionSystem(m_AppContext, deltaTime);
+    const WindowConfig& config = m_AppContext.m_Config.window;
+    sf::Time step = sf::seconds(1.0f / static_cast<float>(std::max(config.tickRate, 1)));
+    auto stepDuration = std::chrono::microseconds(step.asMicroseconds());
+
+    m_StepAccumulator += deltaTime;
+
+    // The steps cover the last m_StepAccumulator of wall time, ending now
+    auto stepStart = InputBuffer::Clock::now()
+                   - std::chrono::microseconds(m_StepAccumulator.asMicroseconds());
+
+    // Stop once a step has queued a state change (e.g. Collision deferring a level
+    // transition): later steps would only queue more of them
+    StateManager& stateManager = *m_AppContext.m_StateManager;
+    int steps = 0;
+    while (m_StepAccumulator >= step && steps < config.maxStepsPerFrame
+           && !stateManager.hasPendingChanges())
+    {
+        m_AppContext.m_Input->beginStep(stepStart, stepStart + stepDuration);
+        if (m_AppContext.m_LatencyProbe)
+        {
+            for (const InputBuffer::KeyEvent& event : m_AppContext.m_Input->stepEvents())
+            {
+                m_AppContext.m_LatencyProbe->onInputConsumed(event.time, m_Tick);
+            }
+        }
+        // Call game logic systems
+        m_Systems.run(m_AppContext, step);
+
+        m_StepAccumulator -= step;
+        stepStart += stepDuration;
+        ++steps;
+        ++m_Tick;
+    }
+
+    // Too far behind (a hitch): drop the backlog instead of spiralling
+    if (m_StepAccumulator >= step)
+    {
+        m_StepAccumulator = sf::Time::Zero;
+    }
+}
 
-    // Descent mechanic
-    if (m_AppContext.m_AppData.levelStarted)
+void PlayState::onConfigReloaded(std::string_view configID)
+{
+    if (configID == Assets::Configs::Levels)
     {
-        float moveAmount = m_DescentSpeed * deltaTime.asSeconds();
-        CoreSystems::moveBricksDown(*m_AppContext.m_Registry, moveAmount);
+        // Levels only change what gets built next, unless asked to restart this one
+        bool isCurrent = (m_AppContext.m_StateManager->getCurrentState() == this);
+        if (m_AppContext.m_Config.window.hotReloadRebuildLevel && isCurrent)
+        {
+            m_AppContext.m_AppData.levelStarted = false;
+            PlayState::load(m_AppContext);
+        }
+        return;
     }
 
+    CoreSystems::applyConfigReload(m_AppContext, m_Registry, configID);
+    markLayerDirty();
+}
+
+void PlayState::registerSystems()
+{
+    // Plays sounds, so it stays on the main thread
+    m_Systems.addSystem("PlayerInput",
+        Reads<PaddleTag, MovementSpeed, Resource<InputBuffer>>{},
+        Writes<Velocity, Resource<AppData>, Resource<sf::Sound>>{},
+        [](SystemContext& ctx) { CoreSystems::handlePlayerInput(ctx.app, ctx.registry); },
+        utils::JobAffinity::MainThread);
+
+    // Descent mechanic (before collision so it sees this frame's brick positions)
+    m_Systems.addSystem("BrickDescent",
+        Reads<BrickHealth, BrickScore, BrickType, Resource<AppData>>{},
+        Writes<Brick>{},
+        [this](SystemContext& ctx) {
+            if (ctx.app.m_AppData.levelStarted)
+            {
+                CoreSystems::moveBricksDown(ctx.registry, m_DescentSpeed * ctx.deltaTime.asSeconds());
+            }
+        });
+
+    m_Systems.addSystem("Movement",
+        Reads<Velocity, MovementSpeed, Resource<AppData>>{},
+        Writes<Paddle, Ball>{},
+        [](SystemContext& ctx) { CoreSystems::movementSystem(ctx.app, ctx.registry, ctx.deltaTime); });
+
+    m_Systems.addSystem("Collision",
+        Reads<MovementSpeed, ConfineToWindow, BrickScore, BrickType, HUDTag, ScoreHUDTag,
+              Resource<AppData>, Resource<AppSettings>, Resource<GameConfig>>{},
+        Writes<Paddle, Ball, Velocity, Brick, BrickHealth, CurrentScore, UIText,
+               Resource<utils::MemoryArena>>{},
+        [](SystemContext& ctx) {
+            CoreSystems::collisionSystem(ctx.app, ctx.registry, ctx.commands, ctx.deltaTime);
+        });
 }
 
-void PlayState::render()
+void PlayState::render(RenderSnapshot& snapshot)
 {
     // Call game rendering systems
     CoreSystems::renderSystem(
-        *m_AppContext.m_Registry,
-        *m_AppContext.m_MainWindow,
+        m_Registry,
+        snapshot,
         m_ShowDebug
     );
 
-    UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    UISystems::uiRenderSystem(m_Registry, snapshot);
+
+    if (m_ShowDebug && m_DebugText)
+    {
+        updateDebugText();
+        snapshot.draw(*m_DebugText);
+    }
+}
+
+void PlayState::initDebugText()
+{
+    auto* font = m_AppContext.m_ResourceManager->getResource<sf::Font>(Assets::Fonts::MainFont);
+    if (!font)
+    {
+        logger::Warn("MainFont not found! Debug overlay disabled.");
+        return;
+    }
+
+    m_DebugText.emplace(*font, "", 16);
+    m_DebugText->setFillColor(sf::Color::Yellow);
+    // one more line with the latency probe's numbers
+    float lines = m_AppContext.m_LatencyProbe ? 2.0f : 1.0f;
+    m_DebugText->setPosition({ 10.0f, m_AppContext.m_AppSettings.targetHeight - 10.0f - 20.0f * lines });
+}
+
+void PlayState::updateDebugText()
+{
+    const FramePacer& pacer = *m_AppContext.m_FramePacer;
+    FrameStats stats = pacer.stats();
+
+    std::string text = std::format(
+        "{} | frame {:.2f} ms (min {:.2f}, max {:.2f}) | jitter (std dev) {:.3f} ms | {} frames",
+        FramePacer::modeName(pacer.mode()), stats.meanMs, stats.minMs, stats.maxMs,
+        stats.stdDevMs, stats.samples);
+
+    if (m_AppContext.m_LatencyProbe)
+    {
+        LatencyStats latency = m_AppContext.m_LatencyProbe->stats();
+        text += std::format(
+            "\ninput->present {:.2f} ms (p50 {:.2f}, p95 {:.2f}, p99 {:.2f}, max {:.2f}) | "
+            "input->tick {:.2f} ms | {} inputs",
+            latency.meanMs, latency.p50Ms, latency.p95Ms, latency.p99Ms, latency.maxMs,
+            latency.meanToTickMs, latency.samples);
+    }
+    m_DebugText->setString(text);
+}
+
+
+//$ ----- LoadingState Implementation -----
+LoadingState::LoadingState(AppContext& context)
+    : State(context)
+{
+    m_Backdrop.setSize({ context.m_AppSettings.targetWidth, context.m_AppSettings.targetHeight });
+    m_Backdrop.setFillColor(sf::Color(0, 0, 0, 160));
+
+    sf::Font* font = context.m_ResourceManager->getResource<sf::Font>(Assets::Fonts::MainFont);
+    if (!font)
+    {
+        logger::Warn("MainFont not found! Loading screen has no text.");
+    }
+    else
+    {
+        m_LoadingText.emplace(*font, "Loading...", 64);
+        m_LoadingText->setFillColor(sf::Color::White);
+        utils::centerOrigin(*m_LoadingText);
+        m_LoadingText->setPosition(getWindowCenter());
+    }
+    // No input of its own; Escape still works (global)
+}
+
+void LoadingState::update(sf::Time deltaTime)
+{
+    m_Elapsed += deltaTime;
 }
 
+void LoadingState::render(RenderSnapshot& snapshot)
+{
+    snapshot.draw(m_Backdrop);
+    if (m_LoadingText)
+    {
+        // pulse, so a long load doesn't look like a hang
+        float pulse = 0.5f + 0.5f * std::sin(m_Elapsed.asSeconds() * 4.0f);
+        auto alpha = static_cast<std::uint8_t>(128.0f + 127.0f * pulse);
+        m_LoadingText->setFillColor(sf::Color(255, 255, 255, alpha));
+        snapshot.draw(*m_LoadingText);
+    }
+}
 
 //$ ----- PauseState Implementation -----
 PauseState::PauseState(AppContext& context)
@@ -458,10 +681,11 @@ PauseState::PauseState(AppContext& context)
 
         // Settings button
         sf::Vector2f buttonSize{ 200.0f, 50.0f };
-        EntityFactory::createButton(context, *font, "Settings",
+        EntityFactory::createButton(m_Registry, *font, "Settings",
             { center.x, center.y + 100.0f },
             [this]() {
-                auto settingsState = std::make_unique<SettingsMenuState>(m_AppContext, true);
+                auto settingsState = m_AppContext.m_StateManager->reuseOrCreate<SettingsMenuState>();
+                settingsState->setFromPlayState(true);
                 m_AppContext.m_StateManager->replaceState(std::move(settingsState));
             },
             UITags::Pause,
@@ -469,57 +693,52 @@ PauseState::PauseState(AppContext& context)
         );
     }
 
-    // Handle music
-    auto* music = context.m_ResourceManager->getResource<sf::Music>(Assets::Musics::MainSong);
-
-    if (music && music->getStatus() == sf::Music::Status::Playing)
-    {
-        music->pause();
-    }
+    m_Music = context.m_ResourceManager->getResource<sf::Music>(Assets::Musics::MainSong);
 
-    m_StateEvents.onMouseButtonPress = [this](const sf::Event::MouseButtonPressed& event) {
-            UISystems::uiClickSystem(*m_AppContext.m_Registry, event);
-        };
+    m_Events.subscribe<sf::Event::MouseButtonPressed>([this](const sf::Event::MouseButtonPressed& event) {
+        UISystems::uiClickSystem(m_Registry, event);
+        return EventResult::Consumed;
+    });
 
-    m_StateEvents.onKeyPress = [this, music](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
+    m_Events.subscribe<sf::Event::KeyPressed>([this](const sf::Event::KeyPressed& event) {
+        if (event.scancode != sf::Keyboard::Scancode::P)
         {
-            m_AppContext.m_MainWindow->close();
+            return EventResult::Pass;
         }
-        else if (event.scancode == sf::Keyboard::Scancode::P)
+
+        bool shouldResume = (m_Music && !m_AppContext.m_AppSettings.musicMuted
+                                     && m_Music->getStatus() == sf::Music::Status::Paused);
+        if (shouldResume)
         {
-            bool shouldResume = (music && !m_AppContext.m_AppSettings.musicMuted
-                                       && music->getStatus() == sf::Music::Status::Paused);
-            if (shouldResume && music)
-            {
-                music->play();
-            }
-            m_AppContext.m_StateManager->popState();
-            logger::Info("Game unpaused.");
+            m_Music->play();
         }
-    };
-
-    logger::Info("Game paused.");
+        m_AppContext.m_StateManager->popState();
+        logger::Info("Game unpaused.");
+        return EventResult::Consumed;
+    });
 }
 
-PauseState::~PauseState()
+void PauseState::onEnter()
 {
-    auto& registry = *m_AppContext.m_Registry;
-    auto view = registry.view<PauseUITag>();
-    registry.destroy(view.begin(), view.end());
+    // Also runs when coming back from Settings, where the music is already paused
+    if (m_Music && m_Music->getStatus() == sf::Music::Status::Playing)
+    {
+        m_Music->pause();
+    }
+    logger::Info("Game paused.");
 }
 
 void PauseState::update(sf::Time deltaTime)
 {
-    UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    // UI hover is event driven (State's MouseMoved subscriber), nothing to do per frame
 }
 
-void PauseState::render()
+void PauseState::render(RenderSnapshot& snapshot)
 {
-    UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    UISystems::uiRenderSystem(m_Registry, snapshot);
     if (m_PauseText)
     {
-        m_AppContext.m_MainWindow->draw(*m_PauseText);
+        snapshot.draw(*m_PauseText);
     }
 }
 
@@ -530,6 +749,21 @@ GameTransitionState::GameTransitionState(AppContext& context, TransitionType typ
     initMenuButtons(type);
     assignStateEvents();
 
+    // Decode the level the top button leads to while the player reads this screen
+    int nextLevel = 0;
+    if (type == TransitionType::LevelWin && context.m_AppData.levelNumber < context.m_AppData.totalLevels)
+    {
+        nextLevel = context.m_AppData.levelNumber + 1;
+    }
+    else if (type == TransitionType::GameWin)
+    {
+        nextLevel = 1;
+    }
+    if (nextLevel > 0 && !context.m_LevelSnapshots.contains(nextLevel))
+    {
+        context.m_LevelPack->prefetch(nextLevel, *context.m_JobSystem);
+    }
+
     // Handle music stuff
     auto* music = context.m_ResourceManager->getResource<sf::Music>(Assets::Musics::MainSong);
     bool wasMusicPlaying = (music && music->getStatus() == sf::Music::Status::Playing);
@@ -542,26 +776,19 @@ GameTransitionState::GameTransitionState(AppContext& context, TransitionType typ
     logger::Info("Game transition state initialized.");
 }
 
-GameTransitionState::~GameTransitionState()
-{
-    auto& registry = *m_AppContext.m_Registry;
-    auto view = registry.view<TransUITag>();
-    registry.destroy(view.begin(), view.end());
-}
-
 void GameTransitionState::update(sf::Time deltaTime)
 {
-    UISystems::uiHoverSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    // UI hover is event driven (State's MouseMoved subscriber), nothing to do per frame
 }
 
-void GameTransitionState::render()
+void GameTransitionState::render(RenderSnapshot& snapshot)
 {
     // Render buttons
-    UISystems::uiRenderSystem(*m_AppContext.m_Registry, *m_AppContext.m_MainWindow);
+    UISystems::uiRenderSystem(m_Registry, snapshot);
     // Render the text
     if (m_TransitionText)
     {
-        m_AppContext.m_MainWindow->draw(*m_TransitionText);
+        snapshot.draw(*m_TransitionText);
     }
 }
 
@@ -633,15 +860,14 @@ void GameTransitionState::initMenuButtons(TransitionType type)
         case TransitionType::LevelLoss:
             topButtonText = "Try Again";
             EntityFactory::createButton(
-                m_AppContext,
+                m_Registry,
                 *font,
                 topButtonText,
                 topButtonPos,
                 [this]() {
                     logger::Info("Try Again button pressed.");
                     m_AppContext.m_AppData.levelStarted = false;
-                    auto playState = std::make_unique<PlayState>(m_AppContext);
-                    m_AppContext.m_StateManager->replaceState(std::move(playState));
+                    PlayState::load(m_AppContext);
                 },
                 buttonTag
             );
@@ -649,7 +875,7 @@ void GameTransitionState::initMenuButtons(TransitionType type)
         case TransitionType::LevelWin:
             topButtonText = "Next Level";
             EntityFactory::createButton(
-                m_AppContext,
+                m_Registry,
                 *font,
                 topButtonText,
                 topButtonPos,
@@ -660,8 +886,7 @@ void GameTransitionState::initMenuButtons(TransitionType type)
                     {
                         m_AppContext.m_AppData.levelNumber++;
                     }
-                    auto playState = std::make_unique<PlayState>(m_AppContext);
-                    m_AppContext.m_StateManager->replaceState(std::move(playState));
+                    PlayState::load(m_AppContext);
                 },
                 buttonTag
             );
@@ -669,15 +894,14 @@ void GameTransitionState::initMenuButtons(TransitionType type)
         case TransitionType::GameWin:
             topButtonText = "Restart";
             EntityFactory::createButton(
-                m_AppContext,
+                m_Registry,
                 *font,
                 topButtonText,
                 topButtonPos,
                 [this]() {
                     logger::Info("Restart button pressed.");
                     m_AppContext.m_AppData.reset();
-                    auto playState = std::make_unique<PlayState>(m_AppContext);
-                    m_AppContext.m_StateManager->replaceState(std::move(playState));
+                    PlayState::load(m_AppContext);
                 },
                 buttonTag
             );
@@ -686,14 +910,14 @@ void GameTransitionState::initMenuButtons(TransitionType type)
 
     // make the "Main Menu" button
     EntityFactory::createButton(
-        m_AppContext,
+        m_Registry,
         *font,
         "Main Menu",
         middleButtonPos,
         [this]() {
             logger::Info("Main menu button pressed.");
             m_AppContext.m_AppData.reset();
-            auto menuState = std::make_unique<MenuState>(m_AppContext);
+            auto menuState = m_AppContext.m_StateManager->reuseOrCreate<MenuState>();
             m_AppContext.m_StateManager->replaceState(std::move(menuState));
         },
         buttonTag
@@ -701,13 +925,13 @@ void GameTransitionState::initMenuButtons(TransitionType type)
 
     // make the "Quit" button
     EntityFactory::createButton(
-        m_AppContext,
+        m_Registry,
         *font,
         "Quit",
         bottomButtonPos,
         [this]() {
             logger::Info("Quit button pressed.");
-            m_AppContext.m_MainWindow->close();
+            m_AppContext.m_Renderer->closeWindow();
         },
         buttonTag
     );
@@ -715,15 +939,8 @@ void GameTransitionState::initMenuButtons(TransitionType type)
 
 void GameTransitionState::assignStateEvents()
 {
-    m_StateEvents.onMouseButtonPress = [this](const sf::Event::MouseButtonPressed& event) {
-        UISystems::uiClickSystem(*m_AppContext.m_Registry, event);
-    };
-
-    m_StateEvents.onKeyPress = [this](const sf::Event::KeyPressed& event) {
-        if (event.scancode == sf::Keyboard::Scancode::Escape)
-        {
-            m_AppContext.m_MainWindow->close();
-        }
-    };
-
+    m_Events.subscribe<sf::Event::MouseButtonPressed>([this](const sf::Event::MouseButtonPressed& event) {
+        UISystems::uiClickSystem(m_Registry, event);
+        return EventResult::Consumed;
+    });
 }
@@ -0,0 +1,71 @@
+#include "Utilities/FileStamp.hpp"
+#include "Utilities/BinaryIO.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace utils
+{
+    std::optional<FileStamp> statFile(std::string_view filepath)
+    {
+        std::error_code error;
+        std::filesystem::path path(filepath);
+        auto mtime = std::filesystem::last_write_time(path, error);
+        if (error)
+        {
+            return std::nullopt;
+        }
+        auto size = std::filesystem::file_size(path, error);
+        if (error)
+        {
+            return std::nullopt;
+        }
+
+        FileStamp stamp;
+        stamp.mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count());
+        stamp.size = static_cast<std::uint64_t>(size);
+        return stamp;
+    }
+
+    std::optional<std::uint64_t> hashFile(std::string_view filepath)
+    {
+        std::ifstream file(std::string(filepath), std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            return std::nullopt;
+        }
+
+        std::vector<char> contents(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+        if (!file)
+        {
+            return std::nullopt;
+        }
+        return hashBytes(std::as_bytes(std::span(contents)));
+    }
+
+    bool fileMatches(std::string_view filepath, const FileStamp& stamp)
+    {
+        std::optional<FileStamp> current = statFile(filepath);
+        if (!current || current->size != stamp.size)
+        {
+            return false;
+        }
+        if (current->mtime == stamp.mtime)
+        {
+            return true;
+        }
+
+        std::optional<std::uint64_t> hash = hashFile(filepath);
+        return hash && *hash == stamp.hash;
+    }
+}
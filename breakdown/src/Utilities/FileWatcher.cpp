@@ -0,0 +1,184 @@
+#include "Utilities/FileWatcher.hpp"
+#include "Utilities/Logger.hpp"
+
+#ifdef __linux__
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // How often the thread checks for stop() (and, without inotify, polls the files)
+    constexpr int PollIntervalMs = 250;
+
+    std::string normalize(const std::filesystem::path& path)
+    {
+        return path.lexically_normal().generic_string();
+    }
+}
+
+namespace utils
+{
+    FileWatcher::~FileWatcher()
+    {
+        stop();
+    }
+
+    void FileWatcher::watch(std::string_view filepath)
+    {
+        std::string path(filepath);
+        m_Files.insert_or_assign(normalize(path), path);
+    }
+
+    bool FileWatcher::start()
+    {
+        if (m_Thread.joinable() || m_Files.empty())
+        {
+            return false;
+        }
+
+#ifdef __linux__
+        m_Inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_Inotify < 0)
+        {
+            logger::Warn("inotify unavailable; file watching disabled.");
+            return false;
+        }
+
+        // Watch directories, not files: a rename-over replaces the file's inode
+        for (const auto& [normalized, path] : m_Files)
+        {
+            std::string directory = normalize(std::filesystem::path(normalized).parent_path());
+            if (directory.empty())
+            {
+                directory = ".";
+            }
+
+            bool alreadyWatched = std::ranges::any_of(m_Directories,
+                [&](const auto& entry) { return entry.second == directory; });
+            if (alreadyWatched)
+            {
+                continue;
+            }
+
+            int descriptor = inotify_add_watch(m_Inotify, directory.c_str(),
+                                               IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (descriptor < 0)
+            {
+                logger::Warn(std::format("Can't watch directory {}.", directory));
+                continue;
+            }
+            m_Directories.emplace(descriptor, directory);
+        }
+#else
+        for (const auto& [normalized, path] : m_Files)
+        {
+            m_Stamps[path] = statFile(path).value_or(FileStamp{});
+        }
+#endif
+
+        m_Stopping = false;
+        m_Thread = std::thread(&FileWatcher::run, this);
+        logger::Info(std::format("Watching {} files for changes.", m_Files.size()));
+        return true;
+    }
+
+    void FileWatcher::stop()
+    {
+        if (!m_Thread.joinable())
+        {
+            return;
+        }
+
+        m_Stopping = true;
+        m_Thread.join();
+
+#ifdef __linux__
+        ::close(m_Inotify);
+        m_Inotify = -1;
+        m_Directories.clear();
+#endif
+    }
+
+    std::vector<std::string> FileWatcher::takeChanged()
+    {
+        std::lock_guard lock(m_Mutex);
+        return std::exchange(m_Changed, {});
+    }
+
+    void FileWatcher::markChanged(const std::string& filepath)
+    {
+        std::lock_guard lock(m_Mutex);
+        if (std::ranges::find(m_Changed, filepath) == m_Changed.end())
+        {
+            m_Changed.push_back(filepath);
+        }
+    }
+
+#ifdef __linux__
+    void FileWatcher::run()
+    {
+        // big enough for a burst of events with file names
+        alignas(inotify_event) char buffer[4096];
+        pollfd descriptor{ m_Inotify, POLLIN, 0 };
+
+        while (!m_Stopping)
+        {
+            if (::poll(&descriptor, 1, PollIntervalMs) <= 0)
+            {
+                continue;
+            }
+
+            ssize_t length = ::read(m_Inotify, buffer, sizeof(buffer));
+            for (ssize_t offset = 0; offset < length; )
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                auto directory = m_Directories.find(event->wd);
+                if (event->len == 0 || directory == m_Directories.end())
+                {
+                    continue;
+                }
+
+                std::string changed = normalize(std::filesystem::path(directory->second) / event->name);
+                if (auto file = m_Files.find(changed); file != m_Files.end())
+                {
+                    markChanged(file->second);
+                }
+            }
+        }
+    }
+#else
+    void FileWatcher::run()
+    {
+        while (!m_Stopping)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(PollIntervalMs));
+
+            for (auto& [path, stamp] : m_Stamps)
+            {
+                std::optional<FileStamp> current = statFile(path);
+                if (current && (current->mtime != stamp.mtime || current->size != stamp.size))
+                {
+                    stamp = *current;
+                    markChanged(path);
+                }
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,593 @@
+#include "Utilities/JobSystem.hpp"
+#include "Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    constexpr std::size_t NotAWorker = std::numeric_limits<std::size_t>::max();
+
+    // Which pool (and which of its workers) the current thread belongs to
+    thread_local const utils::JobSystem* t_Owner = nullptr;
+    thread_local std::size_t t_WorkerIndex = NotAWorker;
+
+    using Clock = std::chrono::steady_clock;
+
+    std::int64_t elapsedNs(Clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    }
+}
+
+namespace utils
+{
+    //$ ----- JobSystem ----- //
+
+    JobSystem::JobSystem(std::size_t workerCount)
+        : m_MainThreadId(std::this_thread::get_id())
+    {
+        if (workerCount == 0)
+        {
+            unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+        }
+
+        // every worker has to exist before any of them starts stealing
+        m_Workers.reserve(workerCount);
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            m_Workers.push_back(std::make_unique<Worker>());
+        }
+        for (std::size_t i = 0; i < workerCount; ++i)
+        {
+            m_Workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+        }
+
+        logger::Info(std::format("JobSystem started with {} worker threads.", workerCount));
+    }
+
+    JobSystem::~JobSystem()
+    {
+        m_Stopping.store(true, std::memory_order_release);
+        {
+            std::lock_guard lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_all();
+
+        for (auto& worker : m_Workers)
+        {
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
+        }
+
+        std::lock_guard lock(m_MainQueueMutex);
+        if (!m_MainQueue.empty())
+        {
+            logger::Warn(std::format("JobSystem shut down with {} main thread jobs never run.",
+                                     m_MainQueue.size()));
+        }
+
+        logStats();
+    }
+
+    JobHandle JobSystem::schedule(std::function<void()> task, JobAffinity affinity)
+    {
+        auto job = makeJob(std::move(task), affinity);
+        release(job);
+        return JobHandle(std::move(job));
+    }
+
+    JobHandle JobSystem::scheduleOnMain(std::function<void()> task)
+    {
+        return schedule(std::move(task), JobAffinity::MainThread);
+    }
+
+    JobHandle JobSystem::then(const JobHandle& dependency, std::function<void()> task,
+                              JobAffinity affinity)
+    {
+        auto job = makeJob(std::move(task), affinity);
+        addDependency(dependency, job);
+        release(job);
+        return JobHandle(std::move(job));
+    }
+
+    JobHandle JobSystem::after(std::span<const JobHandle> dependencies, std::function<void()> task,
+                               JobAffinity affinity)
+    {
+        auto job = makeJob(std::move(task), affinity);
+        for (const auto& dependency : dependencies)
+        {
+            addDependency(dependency, job);
+        }
+        release(job);
+        return JobHandle(std::move(job));
+    }
+
+    void JobSystem::wait(const JobHandle& handle)
+    {
+        if (!isMainThread())
+        {
+            // help out instead of blocking: if every worker slept here, nobody would be left
+            // to run what they're waiting for. Only returns from a main thread job once the
+            // main thread has run it.
+            while (!handle.isDone())
+            {
+                if (!tryRunOne())
+                {
+                    std::this_thread::yield();
+                }
+            }
+            return;
+        }
+
+        while (!handle.isDone())
+        {
+            auto job = popMain();
+            if (!job)
+            {
+                job = stealMatching(*handle.m_Job);
+            }
+            if (job)
+            {
+                execute(job);
+                continue;
+            }
+
+            // Nothing we may run: sleep until a job finishes (which may make more of the
+            // graph runnable) or main thread work shows up
+            m_Waiters.fetch_add(1, std::memory_order_seq_cst);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock lock(m_DoneMutex);
+                m_DoneCondition.wait(lock, [this, &handle]() {
+                    if (handle.isDone())
+                    {
+                        return true;
+                    }
+                    std::lock_guard queueLock(m_MainQueueMutex);
+                    return !m_MainQueue.empty();
+                });
+            }
+            m_Waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    void JobSystem::waitAll(std::span<const JobHandle> handles)
+    {
+        for (const auto& handle : handles)
+        {
+            wait(handle);
+        }
+    }
+
+    void JobSystem::runMainThreadJobs()
+    {
+        // only run what's queued right now; jobs queued by these run next frame
+        std::deque<std::shared_ptr<detail::Job>> jobs;
+        {
+            std::lock_guard lock(m_MainQueueMutex);
+            jobs.swap(m_MainQueue);
+        }
+
+        for (auto& job : jobs)
+        {
+            execute(job);
+        }
+    }
+
+    bool JobSystem::isMainThread() const noexcept
+    {
+        return std::this_thread::get_id() == m_MainThreadId;
+    }
+
+    std::vector<WorkerStats> JobSystem::getWorkerStats() const
+    {
+        std::vector<WorkerStats> stats;
+        stats.reserve(m_Workers.size());
+        for (const auto& worker : m_Workers)
+        {
+            stats.push_back({
+                std::chrono::nanoseconds(worker->busyNs.load(std::memory_order_relaxed)),
+                std::chrono::nanoseconds(worker->idleNs.load(std::memory_order_relaxed)),
+                worker->jobsRun.load(std::memory_order_relaxed),
+                worker->jobsStolen.load(std::memory_order_relaxed)
+            });
+        }
+        return stats;
+    }
+
+    void JobSystem::logStats() const
+    {
+        auto stats = getWorkerStats();
+        for (std::size_t i = 0; i < stats.size(); ++i)
+        {
+            double busyMs = std::chrono::duration<double, std::milli>(stats[i].busy).count();
+            double idleMs = std::chrono::duration<double, std::milli>(stats[i].idle).count();
+            double total = busyMs + idleMs;
+            double busyPercent = (total > 0.0) ? (busyMs / total) * 100.0 : 0.0;
+
+            logger::Info(std::format("Worker {}: {} jobs ({} stolen), busy {:.1f} ms, idle {:.1f} ms ({:.1f}% busy)",
+                                     i, stats[i].jobsRun, stats[i].jobsStolen,
+                                     busyMs, idleMs, busyPercent));
+        }
+    }
+
+    void JobSystem::workerLoop(std::size_t index)
+    {
+        t_Owner = this;
+        t_WorkerIndex = index;
+        Worker& self = *m_Workers[index];
+
+        while (true)
+        {
+            bool stolen = false;
+            auto job = popLocal(index);
+            if (!job)
+            {
+                job = steal(index);
+                stolen = (job != nullptr);
+            }
+
+            if (job)
+            {
+                auto start = Clock::now();
+                execute(job);
+                self.busyNs.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+                self.jobsRun.fetch_add(1, std::memory_order_relaxed);
+                if (stolen)
+                {
+                    self.jobsStolen.fetch_add(1, std::memory_order_relaxed);
+                }
+                continue;
+            }
+
+            if (m_Stopping.load(std::memory_order_acquire))
+            {
+                break;
+            }
+
+            auto idleStart = Clock::now();
+            {
+                std::unique_lock lock(m_WakeMutex);
+                m_WakeCondition.wait(lock, [this]() {
+                    return m_QueuedJobs.load(std::memory_order_acquire) > 0
+                        || m_Stopping.load(std::memory_order_acquire);
+                });
+            }
+            self.idleNs.fetch_add(elapsedNs(idleStart), std::memory_order_relaxed);
+        }
+    }
+
+    std::shared_ptr<detail::Job> JobSystem::makeJob(std::function<void()> task, JobAffinity affinity)
+    {
+        auto job = std::make_shared<detail::Job>();
+        job->task = std::move(task);
+        job->affinity = affinity;
+        return job;
+    }
+
+    void JobSystem::addDependency(const JobHandle& dependency, const std::shared_ptr<detail::Job>& job)
+    {
+        if (!dependency.m_Job)
+        {
+            return;
+        }
+
+        std::lock_guard lock(dependency.m_Job->continuationMutex);
+        if (dependency.m_Job->done.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        job->pending.fetch_add(1, std::memory_order_relaxed);
+        dependency.m_Job->continuations.push_back(job);
+    }
+
+    void JobSystem::release(const std::shared_ptr<detail::Job>& job)
+    {
+        if (job->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            enqueue(job);
+        }
+    }
+
+    void JobSystem::enqueue(std::shared_ptr<detail::Job> job)
+    {
+        if (job->affinity == JobAffinity::MainThread)
+        {
+            {
+                std::lock_guard lock(m_MainQueueMutex);
+                m_MainQueue.push_back(std::move(job));
+            }
+            notifyWaiters();
+            return;
+        }
+
+        // workers keep their own follow-up work local; everyone else round robins
+        std::size_t index = (t_Owner == this && t_WorkerIndex != NotAWorker)
+                          ? t_WorkerIndex
+                          : m_NextQueue.fetch_add(1, std::memory_order_relaxed) % m_Workers.size();
+        {
+            // counted under the queue lock, or a thief could take the job (and decrement)
+            // before the increment and wrap the counter
+            std::lock_guard lock(m_Workers[index]->queueMutex);
+            m_Workers[index]->queue.push_back(std::move(job));
+            m_QueuedJobs.fetch_add(1, std::memory_order_release);
+        }
+
+        {
+            std::lock_guard lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_one();
+    }
+
+    void JobSystem::execute(const std::shared_ptr<detail::Job>& job)
+    {
+        try
+        {
+            job->task();
+        }
+        catch (const std::exception& e)
+        {
+            logger::Error(std::format("Job threw an exception: {}", e.what()));
+        }
+        catch (...)
+        {
+            logger::Error("Job threw an unknown exception.");
+        }
+        // drop the captures now rather than whenever the last handle goes away
+        if (!job->reusable)
+        {
+            job->task = nullptr;
+        }
+
+        std::vector<std::shared_ptr<detail::Job>> continuations;
+        {
+            std::lock_guard lock(job->continuationMutex);
+            job->done.store(true, std::memory_order_release);
+            continuations.swap(job->continuations);
+        }
+        notifyWaiters();
+
+        for (const auto& continuation : continuations)
+        {
+            release(continuation);
+        }
+
+        // The last successor can finish the whole graph, after which the next run may
+        // reset this job: only the count is read once the releases start
+        std::size_t successorCount = job->successors.size();
+        for (std::size_t i = 0; i < successorCount; ++i)
+        {
+            release(job->successors[i]);
+        }
+    }
+
+    std::shared_ptr<detail::Job> JobSystem::popLocal(std::size_t index)
+    {
+        Worker& worker = *m_Workers[index];
+        std::lock_guard lock(worker.queueMutex);
+        if (worker.queue.empty())
+        {
+            return nullptr;
+        }
+
+        auto job = std::move(worker.queue.back());
+        worker.queue.pop_back();
+        m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+        return job;
+    }
+
+    std::shared_ptr<detail::Job> JobSystem::steal(std::size_t thiefIndex)
+    {
+        std::size_t count = m_Workers.size();
+        std::size_t start = (thiefIndex == NotAWorker) ? 0 : thiefIndex + 1;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t victimIndex = (start + i) % count;
+            if (victimIndex == thiefIndex)
+            {
+                continue;
+            }
+
+            Worker& victim = *m_Workers[victimIndex];
+            std::lock_guard lock(victim.queueMutex);
+            if (victim.queue.empty())
+            {
+                continue;
+            }
+
+            // oldest work from the front, the owner keeps the cache-warm back
+            auto job = std::move(victim.queue.front());
+            victim.queue.pop_front();
+            m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return job;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<detail::Job> JobSystem::stealMatching(const detail::Job& waited)
+    {
+        auto matches = [&waited](const std::shared_ptr<detail::Job>& job) {
+            return job.get() == &waited || (waited.graph && job->graph == waited.graph);
+        };
+
+        for (auto& worker : m_Workers)
+        {
+            std::lock_guard lock(worker->queueMutex);
+            auto it = std::ranges::find_if(worker->queue, matches);
+            if (it == worker->queue.end())
+            {
+                continue;
+            }
+
+            auto job = std::move(*it);
+            worker->queue.erase(it);
+            m_QueuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return job;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<detail::Job> JobSystem::popMain()
+    {
+        std::lock_guard lock(m_MainQueueMutex);
+        if (m_MainQueue.empty())
+        {
+            return nullptr;
+        }
+
+        auto job = std::move(m_MainQueue.front());
+        m_MainQueue.pop_front();
+        return job;
+    }
+
+    bool JobSystem::tryRunOne()
+    {
+        std::shared_ptr<detail::Job> job{ nullptr };
+        if (isMainThread())
+        {
+            job = popMain();
+        }
+
+        bool isWorker = (t_Owner == this && t_WorkerIndex != NotAWorker);
+        if (!job && isWorker)
+        {
+            job = popLocal(t_WorkerIndex);
+        }
+        if (!job)
+        {
+            job = steal(isWorker ? t_WorkerIndex : NotAWorker);
+        }
+
+        if (!job)
+        {
+            return false;
+        }
+
+        execute(job);
+        return true;
+    }
+
+    void JobSystem::notifyWaiters()
+    {
+        // pairs with the fence in wait(): either it sees the waiter or the waiter sees us
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_Waiters.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        {
+            std::lock_guard lock(m_DoneMutex);
+        }
+        m_DoneCondition.notify_all();
+    }
+
+    //$ ----- TaskGraph ----- //
+
+    TaskGraph::~TaskGraph()
+    {
+        resetJobs();
+    }
+
+    TaskGraph::NodeId TaskGraph::addTask(std::function<void()> task, JobAffinity affinity)
+    {
+        resetJobs();
+        m_Nodes.push_back({ std::move(task), affinity, {} });
+        return m_Nodes.size() - 1;
+    }
+
+    void TaskGraph::precede(NodeId before, NodeId after)
+    {
+        if (before >= m_Nodes.size() || after >= m_Nodes.size() || before == after)
+        {
+            logger::Error(std::format("Invalid task graph edge {} -> {}.", before, after));
+            return;
+        }
+        resetJobs();
+        m_Nodes[after].dependsOn.push_back(before);
+    }
+
+    void TaskGraph::clear() noexcept
+    {
+        resetJobs();
+        m_Nodes.clear();
+    }
+
+    JobHandle TaskGraph::run(JobSystem& jobs)
+    {
+        if (m_Finished && !m_Finished->done.load(std::memory_order_acquire))
+        {
+            jobs.wait(JobHandle(m_Finished));
+        }
+        if (!m_Finished)
+        {
+            buildJobs(jobs);
+        }
+
+        // Every job is held back by its setup reference until all counts are reset.
+        // A cycle in the graph means those tasks never run.
+        for (std::size_t i = 0; i < m_Nodes.size(); ++i)
+        {
+            m_Jobs[i]->pending.store(static_cast<int>(m_Nodes[i].dependsOn.size()) + 1,
+                                     std::memory_order_relaxed);
+            m_Jobs[i]->done.store(false, std::memory_order_relaxed);
+        }
+        m_Finished->pending.store(static_cast<int>(m_Nodes.size()) + 1, std::memory_order_relaxed);
+        m_Finished->done.store(false, std::memory_order_relaxed);
+
+        for (const auto& job : m_Jobs)
+        {
+            jobs.release(job);
+        }
+        jobs.release(m_Finished);
+
+        return JobHandle(m_Finished);
+    }
+
+    void TaskGraph::buildJobs(JobSystem& jobs)
+    {
+        m_Jobs.reserve(m_Nodes.size());
+        for (const auto& node : m_Nodes)
+        {
+            auto job = jobs.makeJob(node.task, node.affinity);
+            job->reusable = true;
+            job->graph = this;
+            m_Jobs.push_back(std::move(job));
+        }
+
+        m_Finished = jobs.makeJob([]() {}, JobAffinity::Any);
+        m_Finished->reusable = true;
+        m_Finished->graph = this;
+
+        for (std::size_t i = 0; i < m_Nodes.size(); ++i)
+        {
+            for (NodeId dependency : m_Nodes[i].dependsOn)
+            {
+                m_Jobs[dependency]->successors.push_back(m_Jobs[i]);
+            }
+        }
+        // last, so a job is done with its other successors once it lets the graph finish
+        for (const auto& job : m_Jobs)
+        {
+            job->successors.push_back(m_Finished);
+        }
+    }
+
+    void TaskGraph::resetJobs() noexcept
+    {
+        for (const auto& job : m_Jobs)
+        {
+            job->successors.clear();
+        }
+        m_Jobs.clear();
+        m_Finished = nullptr;
+    }
+}
@@ -0,0 +1,22 @@
+#include "Utilities/MemoryArena.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace utils
+{
+    MemoryArena::MemoryArena(std::size_t initialSize)
+        : m_BufferSize(initialSize)
+        , m_Buffer(std::make_unique<std::byte[]>(initialSize))
+        , m_Resource(m_Buffer.get(), m_BufferSize, std::pmr::new_delete_resource())
+    {
+    }
+
+    void MemoryArena::reset() noexcept
+    {
+        // monotonic_buffer_resource goes back to the start of the initial buffer
+        // and hands any overflow blocks back to the upstream (heap) resource
+        m_Resource.release();
+    }
+}
@@ -1,16 +1,189 @@
 #include "Utilities/RandomMachine.hpp"
 #include "Utilities/Logger.hpp"
 
-#include <cmath>
-#include <limits>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <random>
+#include <span>
+
+namespace
+{
+    std::uint64_t splitMix64(std::uint64_t& state) noexcept
+    {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    constexpr std::array<std::uint64_t, 4> JumpPolynomial = {
+        0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+    };
+    constexpr std::array<std::uint64_t, 4> LongJumpPolynomial = {
+        0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull
+    };
+
+    // 24 random mantissa bits -> [0, 1], both ends included
+    constexpr float UnitInclusiveScale = 1.0f / 16777215.0f;
+
+    float unitFloat(std::uint64_t bits) noexcept
+    {
+        return static_cast<float>(bits >> 40) * UnitInclusiveScale;
+    }
+
+    // One xoshiro256** step on every lane. Plain loops over the lanes with no branches,
+    // so each state word of all lanes sits in one vector register.
+    void stepLanes(utils::RandomMachine::LaneState& s,
+                   std::array<std::uint64_t, utils::RandomMachine::LaneCount>& out) noexcept
+    {
+        constexpr std::size_t Lanes = utils::RandomMachine::LaneCount;
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            out[lane] = std::rotl(s[1][lane] * 5, 7) * 9;
+        }
+        for (std::size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const std::uint64_t t = s[1][lane] << 17;
+            s[2][lane] ^= s[0][lane];
+            s[3][lane] ^= s[1][lane];
+            s[1][lane] ^= s[2][lane];
+            s[0][lane] ^= s[3][lane];
+            s[2][lane] ^= t;
+            s[3][lane] = std::rotl(s[3][lane], 45);
+        }
+    }
+
+    // Runs emit(index, bits) for every element, LaneCount elements per step; the lanes
+    // left over at the end are discarded
+    template <typename Emit>
+    void generateLanes(utils::RandomMachine::LaneState& lanes, std::size_t count, Emit&& emit)
+    {
+        constexpr std::size_t Lanes = utils::RandomMachine::LaneCount;
+        std::array<std::uint64_t, Lanes> bits{};
+
+        std::size_t i = 0;
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            stepLanes(lanes, bits);
+            for (std::size_t lane = 0; lane < Lanes; ++lane)
+            {
+                emit(i + lane, bits[lane]);
+            }
+        }
+        if (i < count)
+        {
+            stepLanes(lanes, bits);
+            for (std::size_t lane = 0; i + lane < count; ++lane)
+            {
+                emit(i + lane, bits[lane]);
+            }
+        }
+    }
+}
 
 namespace utils
 {
+    //$ ----- Xoshiro256 ----- //
+    Xoshiro256::Xoshiro256(std::uint64_t seed) noexcept
+    {
+        for (std::uint64_t& word : m_State)
+        {
+            word = splitMix64(seed);
+        }
+    }
+
+    void Xoshiro256::jump() noexcept
+    {
+        jump(JumpPolynomial);
+    }
+
+    void Xoshiro256::longJump() noexcept
+    {
+        jump(LongJumpPolynomial);
+    }
+
+    void Xoshiro256::jump(const std::array<std::uint64_t, 4>& polynomial) noexcept
+    {
+        std::array<std::uint64_t, 4> result{};
+        for (std::uint64_t word : polynomial)
+        {
+            for (int bit = 0; bit < 64; ++bit)
+            {
+                if (word & (std::uint64_t{ 1 } << bit))
+                {
+                    for (std::size_t i = 0; i < result.size(); ++i)
+                    {
+                        result[i] ^= m_State[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        m_State = result;
+    }
+
+    //$ ----- RandomMachine ----- //
     RandomMachine::RandomMachine()
-        : m_RandomDevice()
-        , m_RandomEngine(m_RandomDevice())
     {
+        std::random_device device;
+        std::uint64_t seedValue = (static_cast<std::uint64_t>(device()) << 32) | device();
+        seed(seedValue);
+
+        logger::Info(std::format("RandomMachine seeded with {}.", seedValue));
+    }
+
+    RandomMachine::RandomMachine(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        seed(seedValue, stream);
+    }
+
+    void RandomMachine::seed(std::uint64_t seedValue, std::uint64_t stream)
+    {
+        m_Seed = seedValue;
+        m_Stream = stream;
+
+        m_Engine = Xoshiro256(seedValue);
+        for (std::uint64_t i = 0; i < stream; ++i)
+        {
+            m_Engine.longJump();
+        }
+
+        // Batch lanes: 1..LaneCount jumps past the single-value sequence, all inside
+        // this stream's 2^192 block
+        Xoshiro256 lane = m_Engine;
+        for (std::size_t i = 0; i < LaneCount; ++i)
+        {
+            lane.jump();
+            for (std::size_t word = 0; word < m_Lanes.size(); ++word)
+            {
+                m_Lanes[word][i] = lane.state()[word];
+            }
+        }
+    }
+
+    RandomMachine RandomMachine::makeStream(std::uint64_t stream) const
+    {
+        return RandomMachine(m_Seed, stream);
+    }
+
+    std::uint32_t RandomMachine::bounded(std::uint32_t range) noexcept
+    {
+        std::uint64_t product = (m_Engine() >> 32) * range;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < range)
+        {
+            std::uint32_t threshold = (0u - range) % range;
+            while (low < threshold)
+            {
+                product = (m_Engine() >> 32) * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
     }
 
     int RandomMachine::getInt(int min, int max, int fallback, const std::source_location& loc)
@@ -22,9 +195,12 @@ namespace utils
             );
             return fallback;
         }
-        
-        std::uniform_int_distribution<int> distribution(min, max);
-        return distribution(m_RandomEngine);
+
+        // wraps to 0 for the full int range, where every 32 bit value is valid
+        std::uint32_t range = static_cast<std::uint32_t>(max) - static_cast<std::uint32_t>(min) + 1u;
+        std::uint32_t offset = (range == 0) ? static_cast<std::uint32_t>(m_Engine() >> 32)
+                                            : bounded(range);
+        return static_cast<int>(static_cast<std::uint32_t>(min) + offset);
     }
 
     float RandomMachine::getFloat(float min, float max, float fallback, const std::source_location& loc)
@@ -37,12 +213,48 @@ namespace utils
             return fallback;
         }
 
-        // This will expand the range of returns to include the provided max
-        // Meaning, if passed with (0,1) it will include "1" rather than just 0.9999
-        float inclusiveMax = std::nextafter(max, std::numeric_limits<float>::max());
-        
-        std::uniform_real_distribution<float> distribution(min, inclusiveMax);
-        return distribution(m_RandomEngine);
+        return min + unitFloat(m_Engine()) * (max - min);
+    }
+
+    void RandomMachine::fillInts(std::span<int> out, int min, int max, int fallback,
+                                 const std::source_location& loc)
+    {
+        if (min > max)
+        {
+            logger::Error(std::format(
+                "RandomMachine: Min ({}) is greater than max ({}). Filling with {}.", min, max, fallback), loc
+            );
+            std::ranges::fill(out, fallback);
+            return;
+        }
+
+        // Multiply-shift without the rejection step: the bias is below range / 2^32,
+        // which nothing drawing thousands of numbers at once can notice
+        std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::uint32_t>(max)
+                                                         - static_cast<std::uint32_t>(min)) + 1u;
+        auto base = static_cast<std::uint32_t>(min);
+        generateLanes(m_Lanes, out.size(), [&](std::size_t i, std::uint64_t bits) {
+            auto offset = static_cast<std::uint32_t>(((bits >> 32) * range) >> 32);
+            out[i] = static_cast<int>(base + offset);
+        });
+    }
+
+    void RandomMachine::fillFloats(std::span<float> out, float min, float max, float fallback,
+                                   const std::source_location& loc)
+    {
+        if (min > max)
+        {
+            logger::Error(std::format(
+                "RandomMachine: Min ({}) is greater than max ({}). Filling with {}.", min, max, fallback), loc
+            );
+            std::ranges::fill(out, fallback);
+            return;
+        }
+
+        float span = max - min;
+        generateLanes(m_Lanes, out.size(), [&](std::size_t i, std::uint64_t bits) {
+            out[i] = min + unitFloat(bits) * span;
+        });
     }
 
     int RandomMachine::d2()
@@ -94,4 +306,4 @@ namespace utils
     {
         return getFloat(-1.0f, 1.0f);
     }
-}
\ No newline at end of file
+}